@@ -0,0 +1,147 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FRAME_PROFILER__FRAME_PROFILER_HPP_
+#define FRAME_PROFILER__FRAME_PROFILER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <limits>
+#include <string>
+
+namespace frame_profiler
+{
+using Clock = std::chrono::steady_clock;
+
+/* ---- Histogram --------------------------------------------------------------
+ *
+ *  Log-linear histogram of durations in nanoseconds. Each power of two is
+ *  split into four buckets, so a percentile is off by at most 25% while a
+ *  histogram is a fixed size array that never allocates on add.
+ *
+ * -------------------------------------------------------------------------- */
+class Histogram
+{
+  std::array<std::uint64_t, 256> buckets = {};
+
+  std::uint64_t count = 0;
+
+  std::uint64_t sum = 0;
+
+  std::uint64_t min = std::numeric_limits<std::uint64_t>::max();
+
+  std::uint64_t max = 0;
+
+  static auto indexOf(std::uint64_t) noexcept -> std::size_t;
+
+  static auto upperBoundOf(std::size_t) noexcept -> std::uint64_t;
+
+public:
+  auto add(std::uint64_t) noexcept -> void;
+
+  auto size() const noexcept { return count; }
+
+  auto maximum() const noexcept { return max; }
+
+  auto minimum() const noexcept { return count == 0 ? 0 : min; }
+
+  auto mean() const noexcept { return count == 0 ? 0 : sum / count; }
+
+  auto percentile(double) const noexcept -> std::uint64_t;
+};
+
+/* ---- Profiler ---------------------------------------------------------------
+ *
+ *  Aggregates the durations of zones per call path (e.g. "frame/API::updateFrame/
+ *  EntityManager::update"), so that the same function called from different
+ *  places is told apart. The profiler is process wide and disabled by
+ *  default; while disabled, a Zone costs a single atomic load.
+ *
+ *  While tracing, each zone is additionally recorded as a complete event of
+ *  the Chrome trace event format, which can be opened by chrome://tracing or
+ *  https://ui.perfetto.dev to see where the time of a particular frame went.
+ *
+ * -------------------------------------------------------------------------- */
+class Profiler
+{
+  static inline std::atomic<bool> is_enabled = false;
+
+public:
+  static auto clear() -> void;
+
+  static auto enable(bool) -> void;
+
+  static auto enabled() noexcept { return is_enabled.load(std::memory_order_relaxed); }
+
+  static auto enter(const char * name) -> std::size_t;
+
+  static auto leave(std::size_t node, const Clock::time_point & begin) -> void;
+
+  static auto startTrace(const std::string & path) -> void;
+
+  static auto stopTrace() -> void;
+
+  static auto tracing() -> bool;
+
+  static auto getHistogram(const std::string & path) -> Histogram;
+
+  static auto makeDiagnosticArray(const std::string & prefix)
+    -> diagnostic_msgs::msg::DiagnosticArray;
+};
+
+/* ---- Zone -------------------------------------------------------------------
+ *
+ *  Measures the lifetime of itself. The name must be a string literal (or
+ *  otherwise outlive the profiler), since it is referred to and not copied.
+ *
+ *    auto EntityManager::update(...)
+ *    {
+ *      frame_profiler::Zone zone("EntityManager::update");
+ *      ...
+ *    }
+ *
+ * -------------------------------------------------------------------------- */
+class Zone
+{
+  static constexpr auto disabled = std::numeric_limits<std::size_t>::max();
+
+  const std::size_t node;
+
+  const Clock::time_point begin;
+
+public:
+  explicit Zone(const char * name)
+  : node(Profiler::enabled() ? Profiler::enter(name) : disabled),
+    begin(node == disabled ? Clock::time_point() : Clock::now())
+  {
+  }
+
+  Zone(const Zone &) = delete;
+
+  Zone(Zone &&) = delete;
+
+  ~Zone()
+  {
+    if (node != disabled) {
+      Profiler::leave(node, begin);
+    }
+  }
+};
+}  // namespace frame_profiler
+
+#endif  // FRAME_PROFILER__FRAME_PROFILER_HPP_
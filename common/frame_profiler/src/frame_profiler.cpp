@@ -0,0 +1,294 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <frame_profiler/frame_profiler.hpp>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace frame_profiler
+{
+auto Histogram::indexOf(std::uint64_t value) noexcept -> std::size_t
+{
+  if (value < 16) {
+    return value;
+  } else {
+    std::size_t exponent = 63;
+    while (not(value >> exponent)) {
+      --exponent;
+    }
+    return 16 + (exponent - 4) * 4 + ((value >> (exponent - 2)) & 0b11);
+  }
+}
+
+auto Histogram::upperBoundOf(std::size_t index) noexcept -> std::uint64_t
+{
+  if (index < 16) {
+    return index;
+  } else {
+    const auto exponent = (index - 16) / 4 + 4;
+    const auto mantissa = (index - 16) % 4 + 1;
+    return exponent == 63 and mantissa == 4 ? std::numeric_limits<std::uint64_t>::max()
+                                            : (std::uint64_t(4 + mantissa) << (exponent - 2)) - 1;
+  }
+}
+
+auto Histogram::add(std::uint64_t value) noexcept -> void
+{
+  ++buckets[indexOf(value)];
+  ++count;
+  sum += value;
+  min = std::min(min, value);
+  max = std::max(max, value);
+}
+
+auto Histogram::percentile(double p) const noexcept -> std::uint64_t
+{
+  const auto rank = static_cast<std::uint64_t>(std::ceil(p / 100 * count));
+  std::uint64_t accumulated = 0;
+  for (std::size_t index = 0; index < buckets.size(); ++index) {
+    if (rank <= (accumulated += buckets[index]) and 0 < accumulated) {
+      return std::clamp(upperBoundOf(index), minimum(), max);
+    }
+  }
+  return max;
+}
+
+namespace
+{
+struct Node
+{
+  const char * name;
+
+  std::size_t parent;
+
+  std::string path;
+
+  std::vector<std::size_t> children;
+
+  Histogram histogram;
+};
+
+struct Event
+{
+  std::size_t node;
+
+  Clock::time_point begin;
+
+  Clock::duration duration;
+
+  std::size_t thread;
+};
+
+/*
+   NOTE: Up to about 32 MiB of events. A trace longer than this is cut rather
+   than slowing the simulation down by growing without bound.
+*/
+constexpr std::size_t maximum_event_count = 1 << 20;
+
+struct State
+{
+  std::mutex mutex;
+
+  std::vector<Node> nodes{Node{"", 0, "", {}, {}}};
+
+  std::string trace_path;
+
+  Clock::time_point trace_begin;
+
+  std::vector<Event> events;
+
+  std::size_t dropped_event_count = 0;
+};
+
+auto state() -> State &
+{
+  static State state;
+  return state;
+}
+
+thread_local std::size_t current_node = 0;
+
+auto escape(const std::string & s)
+{
+  std::string result;
+  for (const auto c : s) {
+    if (c == '"' or c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+auto writeTrace(State & state) -> void
+{
+  std::ofstream ofs(state.trace_path);
+
+  ofs << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+  auto microseconds = [](auto && duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+
+  const char * separator = "";
+
+  for (const auto & event : state.events) {
+    ofs << separator << "\n{\"name\":\"" << escape(state.nodes[event.node].name)
+        << "\",\"cat\":\"frame_profiler\",\"ph\":\"X\",\"ts\":"
+        << microseconds(event.begin - state.trace_begin)
+        << ",\"dur\":" << microseconds(event.duration) << ",\"pid\":" << ::getpid()
+        << ",\"tid\":" << event.thread << "}";
+    separator = ",";
+  }
+
+  ofs << "\n],\"otherData\":{\"droppedEvents\":\"" << state.dropped_event_count << "\"}}\n";
+}
+}  // namespace
+
+auto Profiler::clear() -> void
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+  for (auto && node : state().nodes) {
+    node.histogram = Histogram();
+  }
+}
+
+auto Profiler::enable(bool enabled) -> void { is_enabled.store(enabled); }
+
+auto Profiler::enter(const char * name) -> std::size_t
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+
+  auto & nodes = state().nodes;
+
+  for (const auto child : nodes[current_node].children) {
+    if (nodes[child].name == name or std::strcmp(nodes[child].name, name) == 0) {
+      return current_node = child;
+    }
+  }
+
+  const auto child = nodes.size();
+  nodes.push_back(Node{
+    name, current_node,
+    nodes[current_node].path.empty() ? name : nodes[current_node].path + "/" + name, {}, {}});
+  nodes[current_node].children.push_back(child);
+  return current_node = child;
+}
+
+auto Profiler::leave(std::size_t node, const Clock::time_point & begin) -> void
+{
+  const auto duration = Clock::now() - begin;
+
+  std::lock_guard<std::mutex> lock(state().mutex);
+
+  state().nodes[node].histogram.add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+
+  current_node = state().nodes[node].parent;
+
+  if (not state().trace_path.empty()) {
+    if (state().events.size() < maximum_event_count) {
+      static std::atomic<std::size_t> thread_count = 0;
+      static thread_local const auto thread = thread_count++;
+      state().events.push_back(Event{node, begin, duration, thread});
+    } else {
+      ++state().dropped_event_count;
+    }
+  }
+}
+
+auto Profiler::startTrace(const std::string & path) -> void
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+  state().trace_path = path;
+  state().trace_begin = Clock::now();
+  state().events.clear();
+  state().dropped_event_count = 0;
+}
+
+auto Profiler::stopTrace() -> void
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+  if (not state().trace_path.empty()) {
+    writeTrace(state());
+    state().trace_path.clear();
+    state().events.clear();
+    state().events.shrink_to_fit();
+  }
+}
+
+auto Profiler::tracing() -> bool
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+  return not state().trace_path.empty();
+}
+
+auto Profiler::getHistogram(const std::string & path) -> Histogram
+{
+  std::lock_guard<std::mutex> lock(state().mutex);
+  for (const auto & node : state().nodes) {
+    if (node.path == path) {
+      return node.histogram;
+    }
+  }
+  return Histogram();
+}
+
+auto Profiler::makeDiagnosticArray(const std::string & prefix)
+  -> diagnostic_msgs::msg::DiagnosticArray
+{
+  auto milliseconds = [](auto && nanoseconds) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << nanoseconds / 1e6;
+    return ss.str();
+  };
+
+  auto key_value = [](auto && key, auto && value) {
+    diagnostic_msgs::msg::KeyValue key_value;
+    key_value.key = key;
+    key_value.value = value;
+    return key_value;
+  };
+
+  diagnostic_msgs::msg::DiagnosticArray diagnostic_array;
+
+  std::lock_guard<std::mutex> lock(state().mutex);
+
+  for (const auto & node : state().nodes) {
+    if (0 < node.histogram.size()) {
+      diagnostic_msgs::msg::DiagnosticStatus status;
+      status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+      status.name = prefix + node.path;
+      status.hardware_id = prefix;
+      status.values.push_back(key_value("count", std::to_string(node.histogram.size())));
+      status.values.push_back(key_value("mean_ms", milliseconds(node.histogram.mean())));
+      status.values.push_back(key_value("p50_ms", milliseconds(node.histogram.percentile(50))));
+      status.values.push_back(key_value("p99_ms", milliseconds(node.histogram.percentile(99))));
+      status.values.push_back(key_value("max_ms", milliseconds(node.histogram.maximum())));
+      diagnostic_array.status.push_back(status);
+    }
+  }
+
+  return diagnostic_array;
+}
+}  // namespace frame_profiler
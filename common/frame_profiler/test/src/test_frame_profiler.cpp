@@ -0,0 +1,63 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <frame_profiler/frame_profiler.hpp>
+
+TEST(Histogram, Percentile)
+{
+  frame_profiler::Histogram histogram;
+  for (std::uint64_t i = 1; i <= 1000; ++i) {
+    histogram.add(i * 1000);
+  }
+  EXPECT_EQ(histogram.size(), 1000U);
+  EXPECT_EQ(histogram.minimum(), 1000U);
+  EXPECT_EQ(histogram.maximum(), 1000000U);
+  EXPECT_NEAR(histogram.percentile(50), 500000, 500000 * 0.25);
+  EXPECT_NEAR(histogram.percentile(99), 990000, 990000 * 0.25);
+  EXPECT_EQ(histogram.percentile(100), 1000000U);
+}
+
+TEST(Profiler, Hierarchy)
+{
+  frame_profiler::Profiler::enable(true);
+  for (int i = 0; i < 3; ++i) {
+    frame_profiler::Zone frame("frame");
+    {
+      frame_profiler::Zone update("update");
+    }
+    {
+      frame_profiler::Zone update("update");
+    }
+  }
+  {
+    frame_profiler::Zone update("update");
+  }
+  frame_profiler::Profiler::enable(false);
+  {
+    frame_profiler::Zone frame("frame");
+  }
+  EXPECT_EQ(frame_profiler::Profiler::getHistogram("frame").size(), 3U);
+  EXPECT_EQ(frame_profiler::Profiler::getHistogram("frame/update").size(), 6U);
+  EXPECT_EQ(frame_profiler::Profiler::getHistogram("update").size(), 1U);
+  EXPECT_EQ(frame_profiler::Profiler::makeDiagnosticArray("test/").status.size(), 3U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <geometry/spline/catmull_rom_spline.hpp>
+#include <vector>
+
+namespace
+{
+/*
+   A gently winding road sampled every 5 m, which is about how the route of
+   an entity looks to the spline.
+*/
+auto makeControlPoints(std::size_t size)
+{
+  std::vector<geometry_msgs::msg::Point> control_points;
+  for (std::size_t i = 0; i < size; ++i) {
+    geometry_msgs::msg::Point point;
+    point.x = 5.0 * i;
+    point.y = 10.0 * std::sin(0.05 * point.x);
+    control_points.push_back(point);
+  }
+  return control_points;
+}
+
+auto makePoint(double x, double y)
+{
+  geometry_msgs::msg::Point point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+
+auto sValues(const math::geometry::CatmullRomSpline & spline, std::size_t size = 64)
+{
+  std::vector<double> s_values;
+  for (std::size_t i = 0; i < size; ++i) {
+    s_values.push_back(spline.getLength() * i / size);
+  }
+  return s_values;
+}
+}  // namespace
+
+static void Construct(benchmark::State & state)
+{
+  const auto control_points = makeControlPoints(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(math::geometry::CatmullRomSpline(control_points));
+  }
+}
+
+BENCHMARK(Construct)->RangeMultiplier(4)->Range(4, 1024);
+
+static void GetPoint(benchmark::State & state)
+{
+  const auto spline = math::geometry::CatmullRomSpline(makeControlPoints(state.range(0)));
+  const auto s_values = sValues(spline);
+  for (auto _ : state) {
+    for (const auto s : s_values) {
+      benchmark::DoNotOptimize(spline.getPoint(s));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_values.size());
+}
+
+BENCHMARK(GetPoint)->RangeMultiplier(4)->Range(4, 1024);
+
+static void GetPose(benchmark::State & state)
+{
+  const auto spline = math::geometry::CatmullRomSpline(makeControlPoints(state.range(0)));
+  const auto s_values = sValues(spline);
+  for (auto _ : state) {
+    for (const auto s : s_values) {
+      benchmark::DoNotOptimize(spline.getPose(s));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * s_values.size());
+}
+
+BENCHMARK(GetPose)->RangeMultiplier(4)->Range(4, 1024);
+
+static void GetSValue(benchmark::State & state)
+{
+  auto spline = math::geometry::CatmullRomSpline(makeControlPoints(state.range(0)));
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (const auto s : sValues(spline, 16)) {
+    poses.push_back(spline.getPose(s));
+    poses.back().position.y += 0.5;
+  }
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(spline.getSValue(pose));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+
+BENCHMARK(GetSValue)->RangeMultiplier(4)->Range(4, 1024);
+
+/*
+   A line segment crossing the spline near its end, so that a forward search
+   has to go through (almost) all of the curves before finding the collision.
+*/
+static void GetCollisionPointIn2DWithLineSegment(benchmark::State & state)
+{
+  const auto spline = math::geometry::CatmullRomSpline(makeControlPoints(state.range(0)));
+  const auto point = spline.getPoint(spline.getLength() * 0.9);
+  const auto point0 = makePoint(point.x, point.y + 20);
+  const auto point1 = makePoint(point.x, point.y - 20);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline.getCollisionPointIn2D(point0, point1));
+  }
+}
+
+BENCHMARK(GetCollisionPointIn2DWithLineSegment)->RangeMultiplier(4)->Range(4, 1024);
+
+/*
+   The bounding box of a vehicle (4.5 m x 2 m) standing on the spline near
+   its end, which is what the collision checks between entities look like.
+*/
+static void GetCollisionPointIn2DWithPolygon(benchmark::State & state)
+{
+  const auto spline = math::geometry::CatmullRomSpline(makeControlPoints(state.range(0)));
+  const auto point = spline.getPoint(spline.getLength() * 0.9);
+  const auto polygon = std::vector<geometry_msgs::msg::Point>{
+    makePoint(point.x - 2.25, point.y - 1.0), makePoint(point.x + 2.25, point.y - 1.0),
+    makePoint(point.x + 2.25, point.y + 1.0), makePoint(point.x - 2.25, point.y + 1.0)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline.getCollisionPointIn2D(polygon));
+  }
+}
+
+BENCHMARK(GetCollisionPointIn2DWithPolygon)->RangeMultiplier(4)->Range(4, 1024);
+
+BENCHMARK_MAIN();
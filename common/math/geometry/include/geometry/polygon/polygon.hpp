@@ -28,6 +28,13 @@ std::vector<double> filterByAxis(
   const std::vector<geometry_msgs::msg::Point> & points, const Axis & axis);
 std::vector<geometry_msgs::msg::Point> get2DConvexHull(
   const std::vector<geometry_msgs::msg::Point> & points);
+/*
+   Ramer-Douglas-Peucker simplification. Returns the subset of the given
+   polyline vertices (always including both ends) such that no removed vertex
+   is farther than the tolerance from the simplified polyline.
+*/
+std::vector<geometry_msgs::msg::Point> simplifyPolyline(
+  const std::vector<geometry_msgs::msg::Point> & points, double tolerance);
 }  // namespace geometry
 }  // namespace math
 
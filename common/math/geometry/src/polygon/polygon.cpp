@@ -14,9 +14,11 @@
 
 #include <quaternion_operation/quaternion_operation.h>
 
+#include <algorithm>
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <cmath>
 #include <geometry/polygon/polygon.hpp>
 #include <rclcpp/rclcpp.hpp>
 
@@ -87,5 +89,58 @@ std::vector<double> filterByAxis(
   }
   return ret;
 }
+
+std::vector<geometry_msgs::msg::Point> simplifyPolyline(
+  const std::vector<geometry_msgs::msg::Point> & points, double tolerance)
+{
+  if (points.size() < 3) {
+    return points;
+  }
+
+  auto distance_to_segment = [](const auto & p, const auto & a, const auto & b) {
+    const auto ab_x = b.x - a.x, ab_y = b.y - a.y, ab_z = b.z - a.z;
+    const auto ap_x = p.x - a.x, ap_y = p.y - a.y, ap_z = p.z - a.z;
+    const auto squared_length = ab_x * ab_x + ab_y * ab_y + ab_z * ab_z;
+    const auto inner_product = ap_x * ab_x + ap_y * ab_y + ap_z * ab_z;
+    const auto t = squared_length == 0 ? 0.0 : std::clamp(inner_product / squared_length, 0.0, 1.0);
+    return std::hypot(ap_x - t * ab_x, ap_y - t * ab_y, ap_z - t * ab_z);
+  };
+
+  std::vector<bool> kept(points.size(), false);
+  kept.front() = kept.back() = true;
+
+  /*
+     NOTE: An explicit stack instead of recursion, since a waypoint array can
+     be long enough that the worst case recursion depth matters.
+  */
+  std::vector<std::pair<std::size_t, std::size_t>> ranges{{0, points.size() - 1}};
+
+  while (not ranges.empty()) {
+    const auto [first, last] = ranges.back();
+    ranges.pop_back();
+    auto farthest = first;
+    auto farthest_distance = tolerance;
+    for (auto i = first + 1; i < last; ++i) {
+      if (const auto d = distance_to_segment(points[i], points[first], points[last]);
+          farthest_distance < d) {
+        farthest = i;
+        farthest_distance = d;
+      }
+    }
+    if (farthest != first) {
+      kept[farthest] = true;
+      ranges.emplace_back(first, farthest);
+      ranges.emplace_back(farthest, last);
+    }
+  }
+
+  std::vector<geometry_msgs::msg::Point> simplified;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (kept[i]) {
+      simplified.push_back(points[i]);
+    }
+  }
+  return simplified;
+}
 }  // namespace geometry
 }  // namespace math
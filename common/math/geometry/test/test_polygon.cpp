@@ -14,7 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <geometry/polygon/polygon.hpp>
+#include <limits>
 
 #include "expect_eq_macros.hpp"
 
@@ -128,6 +131,62 @@ TEST(Polygon, get2DConvexHull)
   EXPECT_POINT_EQ(hull[3], p2);
 }
 
+TEST(Polygon, simplifyPolylineStraight)
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  for (int i = 0; i <= 100; ++i) {
+    geometry_msgs::msg::Point p;
+    p.x = i;
+    points.emplace_back(p);
+  }
+  const auto simplified = math::geometry::simplifyPolyline(points, 0.01);
+  EXPECT_EQ(simplified.size(), static_cast<size_t>(2));
+  EXPECT_POINT_EQ(simplified.front(), points.front());
+  EXPECT_POINT_EQ(simplified.back(), points.back());
+}
+
+TEST(Polygon, simplifyPolylineCorner)
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  for (int i = 0; i <= 20; ++i) {
+    geometry_msgs::msg::Point p;
+    p.x = std::min(i, 10);
+    p.y = std::max(i - 10, 0);
+    points.emplace_back(p);
+  }
+  const auto simplified = math::geometry::simplifyPolyline(points, 0.01);
+  EXPECT_EQ(simplified.size(), static_cast<size_t>(3));
+  EXPECT_POINT_EQ(simplified[1], points[10]);
+}
+
+TEST(Polygon, simplifyPolylineTolerance)
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  for (int i = 0; i <= 100; ++i) {
+    geometry_msgs::msg::Point p;
+    p.x = 50.0 * std::cos(i * 0.0157);
+    p.y = 50.0 * std::sin(i * 0.0157);
+    points.emplace_back(p);
+  }
+  const auto simplified = math::geometry::simplifyPolyline(points, 0.1);
+  EXPECT_LT(simplified.size(), points.size());
+  for (const auto & point : points) {
+    auto distance = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i + 1 < simplified.size(); ++i) {
+      const auto & a = simplified[i];
+      const auto & b = simplified[i + 1];
+      const auto t = std::clamp(
+        ((point.x - a.x) * (b.x - a.x) + (point.y - a.y) * (b.y - a.y)) /
+          (std::pow(b.x - a.x, 2) + std::pow(b.y - a.y, 2)),
+        0.0, 1.0);
+      distance = std::min(
+        distance, std::hypot(point.x - a.x - t * (b.x - a.x), point.y - a.y - t * (b.y - a.y)));
+    }
+    EXPECT_LE(distance, 0.1);
+  }
+  EXPECT_EQ(math::geometry::simplifyPolyline(points, 0.0).size(), points.size());
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
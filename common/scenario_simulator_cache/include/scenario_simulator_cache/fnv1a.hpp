@@ -0,0 +1,51 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCENARIO_SIMULATOR_CACHE__FNV1A_HPP_
+#define SCENARIO_SIMULATOR_CACHE__FNV1A_HPP_
+
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+namespace common
+{
+/*
+   The 64-bit FNV-1a hash of the content of a file, in 16 hexadecimal digits.
+
+   NOTE: std::hash is not used because these hashes name files and
+   directories on disk that outlive the process (e.g. converted catalogs and
+   map artifacts), and so they must be stable across processes and builds.
+*/
+inline auto fnv1a(const boost::filesystem::path & path) -> std::string
+{
+  std::ifstream ifs(path.string(), std::ios::binary);
+
+  std::uint64_t hash = 14695981039346656037ULL;
+
+  for (std::istreambuf_iterator<char> iter(ifs), end; iter != end; ++iter) {
+    hash = (hash ^ static_cast<unsigned char>(*iter)) * 1099511628211ULL;
+  }
+
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+}  // namespace common
+
+#endif  // SCENARIO_SIMULATOR_CACHE__FNV1A_HPP_
@@ -0,0 +1,123 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCENARIO_SIMULATOR_CACHE__LEAST_RECENTLY_USED_CACHE_HPP_
+#define SCENARIO_SIMULATOR_CACHE__LEAST_RECENTLY_USED_CACHE_HPP_
+
+#include <algorithm>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+namespace common
+{
+struct CacheStatistics
+{
+  std::size_t size = 0;
+  std::size_t capacity = 0;
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t evictions = 0;
+};
+
+inline std::ostream & operator<<(std::ostream & os, const CacheStatistics & statistics)
+{
+  const auto lookups = statistics.hits + statistics.misses;
+  return os << statistics.size << "/" << statistics.capacity << " entries, " << statistics.hits
+            << " hits, " << statistics.misses << " misses ("
+            << (lookups == 0 ? 0.0 : 100.0 * statistics.hits / lookups) << "% hit), "
+            << statistics.evictions << " evictions";
+}
+
+/*
+   Cache holding at most `capacity` entries. Both looking an entry up and
+   inserting it make it the most recently used one, and the least recently used
+   entry is evicted when the capacity is exceeded.
+*/
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LeastRecentlyUsedCache
+{
+public:
+  explicit LeastRecentlyUsedCache(std::size_t capacity)
+  : capacity_(std::max<std::size_t>(capacity, 1))
+  {
+  }
+  boost::optional<Value> find(const Key & key)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const auto iter = index_.find(key); iter == index_.end()) {
+      ++statistics_.misses;
+      return boost::none;
+    } else {
+      ++statistics_.hits;
+      entries_.splice(entries_.begin(), entries_, iter->second);
+      return iter->second->second;
+    }
+  }
+  /*
+     Returns the value that is no longer held by the cache because of this
+     insertion, either the previous value of the same key or the evicted one.
+  */
+  boost::optional<Value> insert(const Key & key, const Value & value)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const auto iter = index_.find(key); iter != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, iter->second);
+      return std::exchange(iter->second->second, value);
+    } else {
+      entries_.emplace_front(key, value);
+      index_.emplace(key, entries_.begin());
+      if (capacity_ < entries_.size()) {
+        ++statistics_.evictions;
+        const auto evicted = std::move(entries_.back().second);
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+        return evicted;
+      } else {
+        return boost::none;
+      }
+    }
+  }
+  template <typename F>
+  void forEach(F && f)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto && entry : entries_) {
+      f(entry.second);
+    }
+  }
+  CacheStatistics getStatistics()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto statistics = statistics_;
+    statistics.size = entries_.size();
+    statistics.capacity = capacity_;
+    return statistics;
+  }
+
+private:
+  const std::size_t capacity_;
+  std::list<std::pair<Key, Value>> entries_;
+  std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator, Hash> index_;
+  CacheStatistics statistics_;
+  std::mutex mutex_;
+};
+}  // namespace common
+
+#endif  // SCENARIO_SIMULATOR_CACHE__LEAST_RECENTLY_USED_CACHE_HPP_
@@ -0,0 +1,49 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <scenario_simulator_cache/fnv1a.hpp>
+#include <string>
+
+auto fnv1aOf(const std::string & content) -> std::string
+{
+  const auto path = boost::filesystem::temp_directory_path() /
+                    boost::filesystem::unique_path("test_fnv1a_%%%%-%%%%-%%%%-%%%%");
+  std::ofstream(path.string(), std::ios::binary) << content;
+  const auto hash = common::fnv1a(path);
+  boost::filesystem::remove(path);
+  return hash;
+}
+
+TEST(FNV1a, ReferenceValues)
+{
+  EXPECT_EQ(fnv1aOf(""), "cbf29ce484222325");
+  EXPECT_EQ(fnv1aOf("a"), "af63dc4c8601ec8c");
+  EXPECT_EQ(fnv1aOf("foobar"), "85944171f73967e8");
+}
+
+TEST(FNV1a, BinaryContent)
+{
+  EXPECT_NE(fnv1aOf(std::string("\0", 1)), fnv1aOf(""));
+  EXPECT_NE(fnv1aOf(std::string("a\0b", 3)), fnv1aOf("ab"));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/optional/optional_io.hpp>
+#include <scenario_simulator_cache/least_recently_used_cache.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(LeastRecentlyUsedCache, EvictLeastRecentlyUsed)
+{
+  common::LeastRecentlyUsedCache<int, std::string> cache(2);
+  EXPECT_FALSE(cache.insert(1, "one"));
+  EXPECT_FALSE(cache.insert(2, "two"));
+  EXPECT_EQ(cache.find(1), std::string("one"));  // NOTE: 2 is the least recently used now.
+  EXPECT_EQ(cache.insert(3, "three"), std::string("two"));
+  EXPECT_FALSE(cache.find(2));
+  EXPECT_EQ(cache.find(1), std::string("one"));
+  EXPECT_EQ(cache.find(3), std::string("three"));
+}
+
+TEST(LeastRecentlyUsedCache, ReplaceValue)
+{
+  common::LeastRecentlyUsedCache<int, std::string> cache(2);
+  EXPECT_FALSE(cache.insert(1, "one"));
+  EXPECT_EQ(cache.insert(1, "uno"), std::string("one"));
+  EXPECT_EQ(cache.find(1), std::string("uno"));
+  EXPECT_EQ(cache.getStatistics().size, static_cast<std::size_t>(1));
+}
+
+TEST(LeastRecentlyUsedCache, Statistics)
+{
+  common::LeastRecentlyUsedCache<int, int> cache(0);  // NOTE: Holds at least one entry.
+  cache.insert(1, 1);
+  cache.insert(2, 2);
+  cache.find(1);
+  cache.find(2);
+  const auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.size, static_cast<std::size_t>(1));
+  EXPECT_EQ(statistics.capacity, static_cast<std::size_t>(1));
+  EXPECT_EQ(statistics.hits, static_cast<std::size_t>(1));
+  EXPECT_EQ(statistics.misses, static_cast<std::size_t>(1));
+  EXPECT_EQ(statistics.evictions, static_cast<std::size_t>(1));
+  std::stringstream ss;
+  ss << statistics;
+  EXPECT_EQ(ss.str(), "1/1 entries, 1 hits, 1 misses (50% hit), 1 evictions");
+}
+
+TEST(LeastRecentlyUsedCache, ForEach)
+{
+  common::LeastRecentlyUsedCache<int, int> cache(3);
+  cache.insert(1, 10);
+  cache.insert(2, 20);
+  cache.find(1);
+  std::vector<int> values;
+  cache.forEach([&](int & value) { values.push_back(value++); });
+  EXPECT_EQ(values, std::vector<int>({10, 20}));  // NOTE: From the most recently used.
+  EXPECT_EQ(cache.find(2), 21);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
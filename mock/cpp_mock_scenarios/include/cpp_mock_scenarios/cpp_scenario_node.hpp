@@ -15,6 +15,7 @@
 #ifndef CPP_MOCK_SCENARIOS__CPP_SCENARIO_NODE_HPP_
 #define CPP_MOCK_SCENARIOS__CPP_SCENARIO_NODE_HPP_
 
+#include <frame_profiler/frame_profiler.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <simple_junit/junit5.hpp>
 #include <traffic_simulator/api/api.hpp>
@@ -58,11 +59,15 @@ private:
   std::string scenario_filename_;
   bool exception_expect_;
   std::string junit_path_;
+  std::string report_path_;
   void update();
   virtual void onUpdate() = 0;
   virtual void onInitialize() = 0;
   rclcpp::TimerBase::SharedPtr update_timer_;
   double timeout_;
+  frame_profiler::Histogram frame_durations_;
+  frame_profiler::Clock::time_point start_time_;
+  void report();
   auto configure(
     const std::string & map_path, const std::string & lanelet2_map_file,
     const std::string & scenario_filename, const bool verbose) -> traffic_simulator::Configuration
@@ -74,6 +79,8 @@ private:
       configuration.scenario_path = scenario_filename;
       configuration.verbose = verbose;
       configuration.initialize_duration = 0;
+      configuration.free_running = declare_parameter<bool>("free_running", false);
+      configuration.broadcast_npc_tf = declare_parameter<bool>("broadcast_npc_tf", true);
     }
     checkConfiguration(configuration);
     return configuration;
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""Launch description for benchmarking cpp mock scenarios."""
+
+# Copyright (c) 2020 TIER IV, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from launch import LaunchDescription
+
+from launch.actions import EmitEvent, RegisterEventHandler
+from launch.actions.declare_launch_argument import DeclareLaunchArgument
+from launch.event_handlers import OnProcessExit
+from launch.events import Shutdown
+from launch.substitutions.launch_configuration import LaunchConfiguration
+
+from launch_ros.actions import Node
+
+
+def generate_launch_description():
+    """
+    Run a scenario headless and free-running, and report its throughput.
+
+    The scenario (the throughput scenario by default) is stepped as fast as
+    possible without visualization, and reports the simulated seconds per
+    wall clock second, the frame time percentiles and the peak RSS to
+    report_path when it ends. For example, to compare the number of NPCs:
+
+        for n in 10 100 500; do
+            ros2 launch cpp_mock_scenarios benchmark.launch.py \\
+                npc_count:=$n report_path:=/tmp/throughput-$n.json
+        done
+
+    """
+    scenario = LaunchConfiguration("scenario", default="throughput")
+    scenario_package = LaunchConfiguration("package", default="cpp_mock_scenarios")
+    timeout = LaunchConfiguration("timeout", default=60.0)
+    duration = LaunchConfiguration("duration", default=30.0)
+    npc_count = LaunchConfiguration("npc_count", default=10)
+    attach_sensors = LaunchConfiguration("attach_sensors", default=False)
+    junit_path = LaunchConfiguration("junit_path", default="/tmp/output.xunit.xml")
+    report_path = LaunchConfiguration("report_path", default="/tmp/benchmark.json")
+    scenario_node = Node(
+        package=scenario_package,
+        executable=scenario,
+        name=scenario,
+        output="screen",
+        arguments=[("__log_level:=info")],
+        parameters=[
+            {
+                "attach_sensors": attach_sensors,
+                "broadcast_npc_tf": False,
+                "duration": duration,
+                "free_running": True,
+                "junit_path": junit_path,
+                "npc_count": npc_count,
+                "report_path": report_path,
+                "timeout": timeout,
+            }
+        ],
+    )
+    shutdown_handler = OnProcessExit(
+        target_action=scenario_node, on_exit=[EmitEvent(event=Shutdown())]
+    )
+    return LaunchDescription(
+        [
+            DeclareLaunchArgument(
+                "scenario", default_value=scenario, description="Name of the scenario."
+            ),
+            DeclareLaunchArgument(
+                "package",
+                default_value=scenario_package,
+                description="Name of package your scenario exists",
+            ),
+            DeclareLaunchArgument(
+                "timeout",
+                default_value=timeout,
+                description="Timeout in simulated seconds.",
+            ),
+            DeclareLaunchArgument(
+                "duration",
+                default_value=duration,
+                description="Simulated seconds to run the throughput scenario (< timeout).",
+            ),
+            DeclareLaunchArgument(
+                "npc_count",
+                default_value=npc_count,
+                description="Number of NPCs of the throughput scenario.",
+            ),
+            DeclareLaunchArgument(
+                "attach_sensors",
+                default_value=attach_sensors,
+                description="If true, attach a lidar and a detection sensor to an NPC.",
+            ),
+            DeclareLaunchArgument(
+                "junit_path",
+                default_value=junit_path,
+                description="Path of the junit output.",
+            ),
+            DeclareLaunchArgument(
+                "report_path",
+                default_value=report_path,
+                description="Path of the benchmark report.",
+            ),
+            scenario_node,
+            RegisterEventHandler(event_handler=shutdown_handler),
+            Node(
+                package="simple_sensor_simulator",
+                executable="simple_sensor_simulator_node",
+                name="simple_sensor_simulator_node",
+                output="log",
+                arguments=[("__log_level:=warn")],
+            ),
+        ]
+    )
@@ -0,0 +1,121 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lanelet2_core/Attribute.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cpp_mock_scenarios/catalogs.hpp>
+#include <cpp_mock_scenarios/cpp_scenario_node.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <traffic_simulator/api/api.hpp>
+
+// headers in STL
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+   NPC vehicles driving along every road of the map, used to measure how fast
+   the simulator runs with a given number of entities. Run it by
+   benchmark.launch.py, which runs it in free-running mode without
+   visualization.
+
+   The NPCs are spawned 10 m apart on the roads of the map in the order of
+   their lanelet IDs, so the same npc_count always makes the same scenario.
+   The scenario succeeds when the simulation time reaches the duration, which
+   must be shorter than the timeout, since reaching the timeout is a failure.
+*/
+class Throughput : public cpp_mock_scenarios::CppScenarioNode
+{
+public:
+  explicit Throughput(const rclcpp::NodeOptions & option)
+  : cpp_mock_scenarios::CppScenarioNode(
+      "throughput", ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map",
+      "lanelet2_map.osm", __FILE__, false, option),
+    npc_count(declare_parameter<int>("npc_count", 10)),
+    attach_sensors(declare_parameter<bool>("attach_sensors", false)),
+    duration(declare_parameter<double>("duration", 5.0))
+  {
+    start();
+  }
+
+private:
+  const std::size_t npc_count;
+
+  const bool attach_sensors;
+
+  const double duration;
+
+  void onUpdate() override
+  {
+    if (duration <= api_.getCurrentTime()) {
+      stop(cpp_mock_scenarios::Result::SUCCESS);
+    }
+  }
+
+  void onInitialize() override
+  {
+    const auto & hdmap_utils = api_.getHdmapUtils();
+
+    auto lanelet_ids = hdmap_utils->filterLaneletIds(
+      hdmap_utils->getLaneletIds(), lanelet::AttributeValueString::Road);
+
+    std::sort(lanelet_ids.begin(), lanelet_ids.end());
+
+    std::vector<traffic_simulator_msgs::msg::LaneletPose> lanelet_poses;
+
+    for (const auto lanelet_id : lanelet_ids) {
+      for (double s = 5; s + 5 < hdmap_utils->getLaneletLength(lanelet_id); s += 10) {
+        if (lanelet_poses.size() < npc_count) {
+          lanelet_poses.push_back(traffic_simulator::helper::constructLaneletPose(lanelet_id, s));
+        }
+      }
+    }
+
+    if (not(duration < get_parameter("timeout").as_double())) {
+      stop(
+        cpp_mock_scenarios::Result::FAILURE,
+        "The duration " + std::to_string(duration) + " must be shorter than the timeout " +
+          std::to_string(get_parameter("timeout").as_double()) + ".");
+    }
+
+    if (lanelet_poses.size() < npc_count) {
+      stop(
+        cpp_mock_scenarios::Result::FAILURE,
+        "There is room for only " + std::to_string(lanelet_poses.size()) + " NPCs in the map.");
+    }
+
+    for (std::size_t i = 0; i < lanelet_poses.size(); ++i) {
+      const auto name = "npc" + std::to_string(i);
+      api_.spawn(name, lanelet_poses[i], getVehicleParameters());
+      api_.requestSpeedChange(name, 10, true);
+    }
+
+    if (attach_sensors and not lanelet_poses.empty()) {
+      api_.attachLidarSensor("npc0");
+      api_.attachDetectionSensor("npc0");
+    }
+  }
+};
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  auto component = std::make_shared<Throughput>(options);
+  rclcpp::spin(component);
+  rclcpp::shutdown();
+  return 0;
+}
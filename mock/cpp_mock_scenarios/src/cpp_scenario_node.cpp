@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <sys/resource.h>
+
 #include <cpp_mock_scenarios/cpp_scenario_node.hpp>
+#include <fstream>
 #include <iostream>
 
 namespace cpp_mock_scenarios
@@ -30,16 +33,16 @@ CppScenarioNode::CppScenarioNode(
   get_parameter<std::string>("junit_path", junit_path_);
   declare_parameter<double>("timeout", 10.0);
   get_parameter<double>("timeout", timeout_);
+  declare_parameter<std::string>("report_path", "");
+  get_parameter<std::string>("report_path", report_path_);
 }
 
 void CppScenarioNode::update()
 {
+  const auto begin = frame_profiler::Clock::now();
   onUpdate();
   try {
     api_.updateFrame();
-    if (api_.getCurrentTime() >= timeout_) {
-      stop(Result::FAILURE);
-    }
   } catch (const common::scenario_simulator_exception::Error & e) {
     RCLCPP_ERROR_STREAM(get_logger(), e.what());
     if (exception_expect_) {
@@ -48,6 +51,16 @@ void CppScenarioNode::update()
       stop(Result::FAILURE);
     }
   }
+  /*
+     NOTE: The duration of the frame is recorded before checking the timeout,
+     because stop() never returns and the last frame would be lost otherwise.
+  */
+  frame_durations_.add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(frame_profiler::Clock::now() - begin)
+      .count());
+  if (api_.getCurrentTime() >= timeout_) {
+    stop(Result::FAILURE);
+  }
 }
 
 void CppScenarioNode::start()
@@ -56,7 +69,15 @@ void CppScenarioNode::start()
   onInitialize();
   api_.startNpcLogic();
   using namespace std::chrono_literals;
-  update_timer_ = this->create_wall_timer(50ms, std::bind(&CppScenarioNode::update, this));
+  /*
+     In free-running mode, each frame starts as soon as the previous one is
+     finished instead of every 50 ms. The simulation time still advances by
+     exactly one step per frame, so the result of the scenario is the same.
+  */
+  update_timer_ = this->create_wall_timer(
+    get_parameter("free_running").as_bool() ? 0ms : 50ms,
+    std::bind(&CppScenarioNode::update, this));
+  start_time_ = frame_profiler::Clock::now();
 }
 
 void CppScenarioNode::stop(Result result, const std::string & description)
@@ -81,11 +102,65 @@ void CppScenarioNode::stop(Result result, const std::string & description)
   }
   // junit_.testsuite("cpp_mock_scenario").testcase(scenario_filename_).time = api_.getCurrentTime();
   junit_.write_to(junit_path_.c_str(), "  ");
+  report();
   update_timer_->cancel();
   rclcpp::shutdown();
   std::exit(0);
 }
 
+/*
+   Reports how fast the scenario ran, excluding the initialization (loading
+   the map and spawning the entities). The peak RSS is the one of this
+   process, which does not include simple_sensor_simulator.
+*/
+void CppScenarioNode::report()
+{
+  const auto frames = frame_durations_.size();
+
+  if (frames == 0) {
+    return;
+  }
+
+  const auto wall_time =
+    std::chrono::duration<double>(frame_profiler::Clock::now() - start_time_).count();
+
+  const auto simulation_time = api_.getCurrentTime();
+
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  auto milliseconds = [](auto nanoseconds) { return nanoseconds / 1e6; };
+
+  RCLCPP_INFO_STREAM(
+    get_logger(), frames << " frames, " << simulation_time << " simulated seconds in " << wall_time
+                         << " seconds (" << simulation_time / wall_time
+                         << " simulated seconds per second), frame time p50 "
+                         << milliseconds(frame_durations_.percentile(50)) << " ms, p99 "
+                         << milliseconds(frame_durations_.percentile(99)) << " ms, max "
+                         << milliseconds(frame_durations_.maximum()) << " ms, peak RSS "
+                         << usage.ru_maxrss << " KiB");
+
+  if (not report_path_.empty()) {
+    std::ofstream ofs(report_path_);
+    ofs << "{\n"
+        << "  \"scenario\": \"" << get_name() << "\",\n"
+        << "  \"entities\": " << api_.getEntityNames().size() << ",\n"
+        << "  \"frames\": " << frames << ",\n"
+        << "  \"simulation_time\": " << simulation_time << ",\n"
+        << "  \"wall_time\": " << wall_time << ",\n"
+        << "  \"simulation_time_per_wall_time\": " << simulation_time / wall_time << ",\n"
+        << "  \"frame_time_ms\": {\n"
+        << "    \"mean\": " << milliseconds(frame_durations_.mean()) << ",\n"
+        << "    \"p50\": " << milliseconds(frame_durations_.percentile(50)) << ",\n"
+        << "    \"p90\": " << milliseconds(frame_durations_.percentile(90)) << ",\n"
+        << "    \"p99\": " << milliseconds(frame_durations_.percentile(99)) << ",\n"
+        << "    \"max\": " << milliseconds(frame_durations_.maximum()) << "\n"
+        << "  },\n"
+        << "  \"peak_rss_kib\": " << usage.ru_maxrss << "\n"
+        << "}\n";
+  }
+}
+
 void CppScenarioNode::checkConfiguration(const traffic_simulator::Configuration & configuration)
 {
   try {
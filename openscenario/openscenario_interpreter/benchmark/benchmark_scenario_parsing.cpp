@@ -0,0 +1,127 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <fstream>
+#include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <pugixml.hpp>
+#include <string>
+
+namespace
+{
+/*
+   A scenario of the given number of events, each with its own parameter, an
+   action and a start trigger referring to the parameter. It needs neither a
+   map nor entities, so only the interpreter itself is measured.
+*/
+auto makeScenario(std::size_t size) -> boost::filesystem::path
+{
+  const auto pathname =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path("benchmark_scenario_parsing-%%%%-%%%%.xosc");
+
+  std::ofstream ofs(pathname.string());
+
+  ofs << R"(<?xml version="1.0" encoding="UTF-8"?>)"
+      << R"(<OpenSCENARIO>)"
+      << R"(<FileHeader revMajor="1" revMinor="0" date="2022-01-01T00:00:00" )"
+      << R"(description="benchmark" author="benchmark"/>)"
+      << R"(<ParameterDeclarations>)";
+
+  for (std::size_t i = 0; i < size; ++i) {
+    ofs << R"(<ParameterDeclaration name="parameter-)" << i
+        << R"(" parameterType="double" value=")" << i << R"("/>)";
+  }
+
+  ofs << R"(</ParameterDeclarations>)"
+      << R"(<CatalogLocations/>)"
+      << R"(<RoadNetwork><LogicFile filepath="./"/><SceneGraphFile filepath="./"/></RoadNetwork>)"
+      << R"(<Entities/>)"
+      << R"(<Storyboard>)"
+      << R"(<Init><Actions/></Init>)"
+      << R"(<Story name="story"><Act name="act">)"
+      << R"(<ManeuverGroup name="maneuver-group" maximumExecutionCount="1">)"
+      << R"(<Actors selectTriggeringEntities="false"/>)"
+      << R"(<Maneuver name="maneuver">)";
+
+  for (std::size_t i = 0; i < size; ++i) {
+    ofs << R"(<Event name="event-)" << i << R"(" priority="parallel">)"
+        << R"(<Action name="action-)" << i << R"(">)"
+        << R"(<UserDefinedAction><CustomCommandAction type=":"/></UserDefinedAction>)"
+        << R"(</Action>)"
+        << R"(<StartTrigger><ConditionGroup>)"
+        << R"(<Condition name="condition" conditionEdge="none" delay="0"><ByValueCondition>)"
+        << R"(<SimulationTimeCondition value=")" << i << R"(" rule="greaterThan"/>)"
+        << R"(</ByValueCondition></Condition>)"
+        << R"(<Condition name="condition" conditionEdge="none" delay="0"><ByValueCondition>)"
+        << R"(<ParameterCondition parameterRef="parameter-)" << i
+        << R"(" value="0" rule="greaterThan"/>)"
+        << R"(</ByValueCondition></Condition>)"
+        << R"(</ConditionGroup></StartTrigger>)"
+        << R"(</Event>)";
+  }
+
+  ofs << R"(</Maneuver></ManeuverGroup>)"
+      << R"(<StartTrigger><ConditionGroup>)"
+      << R"(<Condition name="condition" conditionEdge="none" delay="0"><ByValueCondition>)"
+      << R"(<SimulationTimeCondition value="0" rule="greaterThan"/>)"
+      << R"(</ByValueCondition></Condition>)"
+      << R"(</ConditionGroup></StartTrigger>)"
+      << R"(</Act></Story>)"
+      << R"(<StopTrigger/>)"
+      << R"(</Storyboard>)"
+      << R"(</OpenSCENARIO>)";
+
+  return pathname;
+}
+}  // namespace
+
+/*
+   Reading the XML document alone, which is what DocumentCache saves when a
+   scenario is run again.
+*/
+static void ParseDocument(benchmark::State & state)
+{
+  const auto pathname = makeScenario(state.range(0));
+  for (auto _ : state) {
+    pugi::xml_document document;
+    benchmark::DoNotOptimize(document.load_file(pathname.c_str()));
+  }
+  boost::filesystem::remove(pathname);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ParseDocument)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+/*
+   Constructing the syntax tree of the scenario. Except for the very first
+   iteration, the XML document is given by DocumentCache, so this is the
+   cost of configuring the interpreter for a scenario run again.
+*/
+static void ReadOpenScenario(benchmark::State & state)
+{
+  const auto pathname = makeScenario(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(openscenario_interpreter::OpenScenario(pathname));
+  }
+  boost::filesystem::remove(pathname);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ReadOpenScenario)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
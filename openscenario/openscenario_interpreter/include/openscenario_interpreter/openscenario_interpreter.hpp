@@ -51,6 +51,18 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   const rclcpp_lifecycle::LifecyclePublisher<Context>::SharedPtr publisher_of_context;
 
+  bool batch_mode;
+
+  bool publish_context_delta;
+
+  double context_snapshot_rate;
+
+  std::chrono::system_clock::time_point context_snapshot_time;
+
+  bool free_running;
+
+  std::chrono::steady_clock::time_point activation_time;
+
   String intended_result;
 
   double local_frame_rate;
@@ -113,7 +125,7 @@ public:
 
   auto on_shutdown(const rclcpp_lifecycle::State &) -> Result override;
 
-  auto publishCurrentContext() const -> void;
+  auto publishCurrentContext() -> void;
 
   auto reset() -> void;
 
@@ -207,7 +219,9 @@ public:
   template <typename TimeoutHandler, typename Thunk>
   auto withTimeoutHandler(TimeoutHandler && handle, Thunk && thunk) -> decltype(auto)
   {
-    if (const auto time = execution_timer.invoke("", thunk); currentLocalFrameRate() < time) {
+    // NOTE: In free-running mode, there is no frame period to exceed.
+    if (const auto time = execution_timer.invoke("", thunk);
+        not free_running and currentLocalFrameRate() < time) {
       handle(execution_timer.getStatistics(""));
     }
   }
@@ -15,56 +15,38 @@
 #ifndef OPENSCENARIO_INTERPRETER__RECORD_HPP_
 #define OPENSCENARIO_INTERPRETER__RECORD_HPP_
 
-#include <unistd.h>
-
-#ifndef OPENSCENARIO_INTERPRETER_VERBOSE_RECORD
-#include <fcntl.h>
-#include <sys/stat.h>
-#include <sys/types.h>
-#endif  // OPENSCENARIO_INTERPRETER_RECORD_QUIETLY
-
-#include <boost/algorithm/string.hpp>  // boost::algorithm::replace_all_copy
-#include <concealer/execute.hpp>
-#include <cstdlib>
-#include <iostream>
+#include <cstddef>
 #include <string>
-#include <vector>
 
 namespace openscenario_interpreter
 {
 namespace record
 {
-extern pid_t process_id;
-
-template <typename... Ts>
-auto start(Ts &&... xs) -> pid_t
-{
-  const std::vector<std::string> command{
-    "python3", boost::algorithm::replace_all_copy(concealer::dollar("which ros2"), "\n", ""), "bag",
-    "record", std::forward<decltype(xs)>(xs)...};
-
-  switch (process_id = fork()) {
-    case -1:
-      throw std::system_error(errno, std::system_category());
-
-    case 0:
-#ifndef OPENSCENARIO_INTERPRETER_VERBOSE_RECORD
-      if (const auto fd = ::open("/dev/null", O_WRONLY)) {
-        ::dup2(fd, STDOUT_FILENO);
-        ::close(fd);
-      }
-#endif
-      if (concealer::execute(command) < 0) {
-        std::cerr << std::system_error(errno, std::system_category()).what() << std::endl;
-        std::exit(EXIT_FAILURE);
-      }
-      return 0;
-
-    default:
-      return process_id;
-  }
-}
-
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Records the topics whose names match `topics` but not `excluded_topics`
+ *  (ECMAScript regular expressions) into the bag `uri`, within this process
+ *  instead of forking `ros2 bag record`.
+ *
+ *  Messages are received by a node spinning on a thread of the recorder and
+ *  written by another thread through a queue of at most `queue_size`
+ *  messages. Messages arriving while the queue is full are dropped (and
+ *  reported on stop) rather than blocking the simulation. Topics appearing
+ *  after start are subscribed when they are discovered.
+ *
+ *  If the bag cannot be opened (e.g. `uri` already exists), the error is
+ *  printed and nothing is recorded, as ros2 bag record would do.
+ *
+ * -------------------------------------------------------------------------- */
+auto start(
+  const std::string & uri, const std::string & topics, const std::string & excluded_topics,
+  std::size_t queue_size = 10000) -> void;
+
+/*
+   NOTE: Returns once the messages already queued are written and the bag is
+   closed. No grace period is needed, since there is no child process which
+   might not have started recording yet.
+*/
 auto stop() -> void;
 }  // namespace record
 }  // namespace openscenario_interpreter
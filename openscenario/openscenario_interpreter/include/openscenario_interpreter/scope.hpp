@@ -71,32 +71,29 @@ public:
   template <typename T>
   auto find(const Name & name) const -> Object
   {
-    // NOTE: breadth first search
-    for (std::vector<const EnvironmentFrame *> frames{this}; not frames.empty();) {
-      auto objects = [&]() {
-        std::vector<Object> result;
-        for (auto && frame : frames) {
-          boost::range::for_each(frame->variables.equal_range(name), [&](auto && name_and_value) {
-            return result.push_back(name_and_value.second);
-          });
-        }
-        return result;
-      }();
+    /*
+       NOTE: Breadth first search. Most references are resolved at the first
+       level (this frame), which is searched without any allocation.
+    */
+    const EnvironmentFrame * const self = this;
+
+    if (auto found = findFrom<T>(&self, &self + 1, name); found) {
+      return found;
+    }
 
-      switch (boost::range::count_if(objects, is_also<T>())) {
-        case 0:
-          frames = [&]() {
-            std::vector<const EnvironmentFrame *> result;
-            for (auto && current_frame : frames) {
-              boost::range::copy(current_frame->unnamed_inner_frames, std::back_inserter(result));
-            }
-            return result;
-          }();
-          break;
-        case 1:
-          return *boost::range::find_if(objects, is_also<T>());
-        default:
-          throw AmbiguousReferenceTo<T>(name);
+    for (std::vector<const EnvironmentFrame *> frames(
+           std::begin(unnamed_inner_frames), std::end(unnamed_inner_frames));
+         not frames.empty();) {
+      if (auto found = findFrom<T>(std::begin(frames), std::end(frames), name); found) {
+        return found;
+      } else {
+        frames = [&]() {
+          std::vector<const EnvironmentFrame *> result;
+          for (auto && current_frame : frames) {
+            boost::range::copy(current_frame->unnamed_inner_frames, std::back_inserter(result));
+          }
+          return result;
+        }();
       }
     }
 
@@ -136,6 +133,26 @@ public:
   auto isOutermost() const noexcept -> bool;
 
 private:
+  template <typename T, typename Iterator>
+  static auto findFrom(Iterator first, Iterator last, const Name & name) -> Object
+  {
+    Object result;
+
+    for (; first != last; ++first) {
+      for (auto [iter, end] = (*first)->variables.equal_range(name); iter != end; ++iter) {
+        if (is_also<T>()(iter->second)) {
+          if (result) {
+            throw AmbiguousReferenceTo<T>(name);
+          } else {
+            result = iter->second;
+          }
+        }
+      }
+    }
+
+    return result;
+  }
+
   auto resolvePrefix(const Prefixed<Name> &) const -> std::list<const EnvironmentFrame *>;
 
   auto lookupFrame(const Prefixed<Name> &) const -> const EnvironmentFrame *;
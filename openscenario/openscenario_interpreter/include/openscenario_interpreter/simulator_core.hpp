@@ -24,6 +24,7 @@
 #include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/type_traits/requires.hpp>
+#include <optional>
 #include <traffic_simulator/api/api.hpp>
 #include <traffic_simulator_msgs/msg/lanelet_pose.hpp>
 #include <utility>
@@ -42,13 +43,29 @@ class SimulatorCore
 {
   static inline std::unique_ptr<traffic_simulator::API> core = nullptr;
 
+  /*
+     Constructing traffic_simulator::API loads the map, builds the routing
+     graphs and connects to the simulator, which takes seconds. In batch mode,
+     the API of the previous scenario is kept here after being reset, and is
+     reused by the next scenario as long as the configurations are compatible.
+  */
+  static inline std::unique_ptr<traffic_simulator::API> idle_core = nullptr;
+
+  static inline std::optional<traffic_simulator::Configuration> core_configuration = std::nullopt;
+
 public:
   template <typename Node, typename... Ts>
   static auto activate(
     const Node & node, const traffic_simulator::Configuration & configuration, Ts &&... xs) -> void
   {
     if (not active()) {
-      core = std::make_unique<traffic_simulator::API>(node, configuration);
+      if (idle_core and core_configuration->isCompatibleWith(configuration)) {
+        core = std::move(idle_core);
+      } else {
+        idle_core.reset();
+        core = std::make_unique<traffic_simulator::API>(node, configuration);
+      }
+      core_configuration.emplace(configuration);
       core->initialize(std::forward<decltype(xs)>(xs)...);
     } else {
       throw Error("The simulator core has already been instantiated.");
@@ -57,7 +74,17 @@ public:
 
   static auto active() { return static_cast<bool>(core); }
 
-  static auto deactivate() -> void { core.reset(); }
+  static auto deactivate(bool keep_alive = false) -> void
+  {
+    if (keep_alive and core) {
+      core->reset();
+      idle_core = std::move(core);
+    } else {
+      core.reset();
+      idle_core.reset();
+      core_configuration.reset();
+    }
+  }
 
   static auto update() -> void { core->updateFrame(); }
 
@@ -225,6 +252,10 @@ public:
           configuration.set_range(300);
           configuration.set_filter_by_range(
             controller.properties.template get<Boolean>("isClairvoyant"));
+          configuration.set_filter_by_occlusion(
+            controller.properties.template get<Boolean>("isOcclusionAware"));
+          configuration.set_minimum_visible_ratio(
+            controller.properties.template get<Double>("minimumVisibleRatio", 0.0));
           return configuration;
         }());
 
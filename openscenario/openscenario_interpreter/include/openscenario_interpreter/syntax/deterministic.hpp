@@ -17,6 +17,7 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic_parameter_distribution.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -34,9 +35,11 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct Deterministic
 {
-  const std::list<DeterministicParameterDistribution> deterministic_parameter_distributions;
+  std::list<DeterministicParameterDistribution> deterministic_parameter_distributions;
 
   explicit Deterministic(const pugi::xml_node &, Scope & scope);
+
+  auto derive() -> ParameterDistribution;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -17,6 +17,8 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution_type.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -29,13 +31,18 @@ inline namespace syntax
  *    <xsd:sequence>
  *      <xsd:group ref="DeterministicSingleParameterDistributionType"/>
  *    </xsd:sequence>
+ *    <xsd:attribute name="parameterName" type="String" use="required"/>
  *  </xsd:complexType>
  *
  * -------------------------------------------------------------------------- */
 struct DeterministicSingleParameterDistribution
 : public DeterministicSingleParameterDistributionType
 {
+  const String parameter_name;
+
   explicit DeterministicSingleParameterDistribution(const pugi::xml_node &, Scope &);
+
+  auto derive() -> ParameterDistribution;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
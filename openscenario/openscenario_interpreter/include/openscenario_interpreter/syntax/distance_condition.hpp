@@ -81,8 +81,20 @@ struct DistanceCondition : private Scope, private SimulatorCore::CoordinateSyste
 
   std::vector<Double> results;  // for description
 
+  using Distance = double (DistanceCondition::*)(const EntityRef &) const;
+
+  /*
+     NOTE: One of the distance<...> overloads to the position, chosen by
+     specialize when the condition is read, so that evaluating the condition
+     every frame does not dispatch on its attributes again.
+  */
+  const Distance specialized_distance;
+
   explicit DistanceCondition(const pugi::xml_node &, Scope &, const TriggeringEntities &);
 
+  static auto specialize(const CoordinateSystem &, const RelativeDistanceType &, const Boolean &)
+    -> Distance;
+
   auto description() const -> std::string;
 
   auto distance(const EntityRef &) const -> double;
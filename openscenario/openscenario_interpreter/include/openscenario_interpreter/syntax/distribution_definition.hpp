@@ -18,6 +18,7 @@
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic.hpp>
 #include <openscenario_interpreter/syntax/stochastic.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -37,6 +38,8 @@ inline namespace syntax
 struct DistributionDefinition : public Group
 {
   explicit DistributionDefinition(const pugi::xml_node &, Scope & scope);
+
+  auto derive() -> ParameterDistribution;
 };
 
 DEFINE_LAZY_VISITOR(
@@ -16,6 +16,7 @@
 #define OPENSCENARIO_INTERPRETER__DISTRIBUTION_SET_HPP_
 
 #include <openscenario_interpreter/syntax/distribution_set_element.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 
 namespace openscenario_interpreter
 {
@@ -35,6 +36,8 @@ struct DistributionSet : private Scope, public ComplexType
   const std::list<DistributionSetElement> elements;
 
   explicit DistributionSet(const pugi::xml_node &, Scope & scope);
+
+  auto derive() const -> SingleParameterDistribution;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -17,7 +17,9 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/histogram_bin.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/utility/distribution.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -44,7 +46,6 @@ struct Histogram : public ComplexType
   {
     explicit BinAdaptor(const std::list<HistogramBin> & bins)
     {
-      intervals.emplace_back(bins.front().range.lower_limit.data);
       for (const auto & bin : bins) {
         intervals.emplace_back(bin.range.lower_limit.data);
         densities.emplace_back(bin.weight.data);
@@ -58,6 +59,8 @@ struct Histogram : public ComplexType
     distribution;
 
   explicit Histogram(const pugi::xml_node &, Scope & scope);
+
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -49,6 +49,8 @@ struct NormalDistribution : public ComplexType
   StochasticDistributionClass<std::normal_distribution<Double::value_type>> distribution;
 
   explicit NormalDistribution(const pugi::xml_node &, Scope & scope);
+
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -16,6 +16,7 @@
 #define OPENSCENARIO_INTERPRETER__SYNTAX__OPEN_SCENARIO_HPP_
 
 #include <boost/filesystem.hpp>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/file_header.hpp>
@@ -40,7 +41,7 @@ struct OpenScenario : public Scope
 {
   const boost::filesystem::path pathname;  // for substitution syntax '$(dirname)'
 
-  pugi::xml_document script;
+  std::shared_ptr<const pugi::xml_document> script;
 
   const FileHeader file_header;
 
@@ -41,6 +41,8 @@ struct ParameterCondition : private Scope
 
   const Rule rule;
 
+  mutable Object parameter;  // NOTE: Resolved by the first evaluation, then reused.
+
   explicit ParameterCondition(Scope &);
 
   explicit ParameterCondition(const pugi::xml_node &, Scope &);
@@ -49,6 +51,8 @@ struct ParameterCondition : private Scope
 
   /*  */ auto description() const -> String;
 
+  /*  */ auto resolve() const -> const Object &;
+
   /*  */ auto evaluate() const -> Object;
 };
 }  // namespace syntax
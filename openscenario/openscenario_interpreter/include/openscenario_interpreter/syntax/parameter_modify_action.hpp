@@ -38,6 +38,8 @@ struct ParameterModifyAction : Scope
 
   const ModifyRule rule;
 
+  mutable Object parameter;  // NOTE: Resolved by the first start, then reused.
+
   explicit ParameterModifyAction(const pugi::xml_node &, Scope &, const String &);
 
   static auto accomplished() noexcept -> bool;
@@ -36,12 +36,16 @@ struct ParameterSetAction : private Scope
 
   const String value;
 
+  mutable Object parameter;  // NOTE: Resolved by the first start, then reused.
+
   explicit ParameterSetAction(const pugi::xml_node &, Scope &, const String &);
 
   static auto accomplished() noexcept -> bool;
 
   static auto run() noexcept -> void;
 
+  static auto set(const Object &, const String &) -> void;
+
   static auto set(const Scope & scope, const String &, const String &) -> void;
 
   /*  */ auto start() const -> void;
@@ -16,6 +16,7 @@
 #define OPENSCENARIO_INTERPRETER__PARAMETER_VALUE_SET_HPP_
 
 #include <openscenario_interpreter/syntax/parameter_assignment.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 
 namespace openscenario_interpreter
 {
@@ -35,6 +36,8 @@ struct ParameterValueSet : private Scope, public ComplexType
   const std::list<ParameterAssignment> parameter_assignments;
 
   explicit ParameterValueSet(const pugi::xml_node &, Scope & scope);
+
+  auto derive() const -> ParameterList;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
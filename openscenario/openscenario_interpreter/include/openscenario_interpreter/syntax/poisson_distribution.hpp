@@ -18,7 +18,9 @@
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/range.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/utility/distribution.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -43,6 +45,8 @@ struct PoissonDistribution : public ComplexType
   StochasticDistributionClass<std::poisson_distribution<>> distribution;
 
   explicit PoissonDistribution(const pugi::xml_node &, Scope & scope);
+
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -17,6 +17,7 @@
 
 #include <openscenario_interpreter/syntax/probability_distribution_set_element.hpp>
 #include <openscenario_interpreter/utility/distribution.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -54,8 +55,7 @@ struct ProbabilityDistributionSet : public ComplexType
 
   explicit ProbabilityDistributionSet(const pugi::xml_node &, Scope & scope);
 
-  // TODO: implement evaluate()
-  // Use std::discrete_distribution from <random>
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -68,8 +68,19 @@ struct RelativeDistanceCondition : private Scope, private SimulatorCore::Conditi
 
   std::vector<Double> results;  // for description
 
+  using Distance = double (RelativeDistanceCondition::*)(const EntityRef &);
+
+  /*
+     NOTE: One of the distance<...> overloads to entityRef, chosen by
+     specialize when the condition is read instead of every frame.
+  */
+  const Distance specialized_distance;
+
   explicit RelativeDistanceCondition(const pugi::xml_node &, Scope &, const TriggeringEntities &);
 
+  static auto specialize(const CoordinateSystem &, const RelativeDistanceType &, const Boolean &)
+    -> Distance;
+
   auto description() const -> String;
 
   template <CoordinateSystem::value_type, RelativeDistanceType::value_type, Boolean::value_type>
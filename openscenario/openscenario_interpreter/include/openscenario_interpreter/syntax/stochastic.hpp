@@ -19,7 +19,9 @@
 #include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/stochastic_distribution.hpp>
 #include <openscenario_interpreter/syntax/unsigned_integer.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <pugixml.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -39,13 +41,17 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct Stochastic : public ComplexType
 {
-  const StochasticDistribution stochastic_distribution;
+  std::list<StochasticDistribution> stochastic_distributions;
 
   const UnsignedInt number_of_test_runs;
 
   const Double random_seed;
 
+  std::mt19937 random_engine;
+
   explicit Stochastic(const pugi::xml_node &, Scope & scope);
+
+  auto derive() -> ParameterDistribution;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -18,6 +18,7 @@
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/stochastic_distribution_type.hpp>
 #include <pugixml.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -38,6 +39,8 @@ struct StochasticDistribution : public StochasticDistributionType
   const String parameter_name;
 
   explicit StochasticDistribution(const pugi::xml_node &, Scope & scope);
+
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
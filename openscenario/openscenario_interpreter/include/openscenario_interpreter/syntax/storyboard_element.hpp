@@ -23,6 +23,7 @@
 #include <openscenario_interpreter/syntax/catalog_reference.hpp>
 #include <openscenario_interpreter/syntax/storyboard_element_state.hpp>
 #include <openscenario_interpreter/syntax/trigger.hpp>
+#include <openscenario_interpreter/utility/context_delta.hpp>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -179,6 +180,9 @@ public:
   auto transitionTo(const Object & state) -> bool
   {
     current_state = state;
+    if (ContextDelta::recorded()) {
+      ContextDelta::update(this, "currentState", boost::lexical_cast<std::string>(current_state));
+    }
     for (auto && callback : callbacks[current_state.as<StoryboardElementState>()]) {
       callback(std::as_const(*this));
     }
@@ -187,7 +191,15 @@ public:
 
   auto evaluate()
   {
-    if (stop_trigger.evaluate().as<Boolean>()) {
+    /*
+       The completeState can only be left by an external reset from the
+       parent, and a stopTransition is not defined from it. Therefore, the
+       StopTrigger of a completed element (and the whole subtree of conditions
+       behind it) is no longer evaluated.
+    */
+    if (is<StoryboardElementState::completeState>()) {
+      return current_state;
+    } else if (stop_trigger.evaluate().as<Boolean>()) {
       override();
     }
 
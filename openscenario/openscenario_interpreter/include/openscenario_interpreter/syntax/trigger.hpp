@@ -35,7 +35,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct Trigger : public std::list<ConditionGroup>
 {
-  bool current_value;
+  bool current_value = false;
 
   // NOTE: Default constructed Trigger must be return FALSE.
   Trigger() = default;
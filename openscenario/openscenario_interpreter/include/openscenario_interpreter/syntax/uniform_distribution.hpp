@@ -17,7 +17,9 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/range.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/utility/distribution.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -40,8 +42,7 @@ struct UniformDistribution : public ComplexType
 
   explicit UniformDistribution(const pugi::xml_node &, Scope & scope);
 
-  // TODO: implement evaluate()
-  // Use std::uniform_real_distribution from <random>
+  auto derive(std::mt19937 &) -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -16,7 +16,9 @@
 #define OPENSCENARIO_INTERPRETER__SYNTAX__USER_DEFINED_DISTRIBUTION_HPP_
 
 #include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <pugixml.hpp>
+#include <random>
 
 namespace openscenario_interpreter
 {
@@ -41,7 +43,9 @@ struct UserDefinedDistribution : private Scope, public ComplexType
 
   explicit UserDefinedDistribution(const pugi::xml_node &, const Scope &);
 
-  // TODO: implement evaluate()?`
+  [[noreturn]] auto derive() const -> SingleParameterDistribution;
+
+  [[noreturn]] auto derive(std::mt19937 &) const -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
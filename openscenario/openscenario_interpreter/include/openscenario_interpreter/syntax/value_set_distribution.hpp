@@ -17,6 +17,7 @@
 
 #include <openscenario_interpreter/syntax/file.hpp>
 #include <openscenario_interpreter/syntax/parameter_value_set.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 
 namespace openscenario_interpreter
 {
@@ -37,7 +38,7 @@ struct ValueSetDistribution : public Scope, public ComplexType
 
   explicit ValueSetDistribution(const pugi::xml_node &, Scope & scope);
 
-  // TODO: implement evaluate()
+  auto derive() const -> ParameterDistribution;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -0,0 +1,78 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__CONTEXT_DELTA_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__CONTEXT_DELTA_HPP_
+
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/* ---- ContextDelta -----------------------------------------------------------
+ *
+ *  Collects the storyboard element state transitions and the condition value
+ *  changes that occurred since the context was last published. Each changed
+ *  node is keyed by the same identifier as the "id" field written to the
+ *  context snapshot, so a subscriber holding the latest snapshot can apply the
+ *  delta in place without receiving the whole syntax tree again.
+ *
+ *  Only the latest value of each field is kept; intermediate transitions that
+ *  happen within a single frame (e.g. startTransition -> runningState) are
+ *  coalesced, which is the same thing a snapshot would have shown.
+ *
+ * -------------------------------------------------------------------------- */
+class ContextDelta
+{
+  static inline bool recording = false;
+
+  static inline nlohmann::json changes = nlohmann::json::object();
+
+public:
+  static auto identify(const void * address) -> std::string
+  {
+    return std::to_string(reinterpret_cast<std::uintptr_t>(address));
+  }
+
+  static auto record(bool enabled) -> void
+  {
+    recording = enabled;
+    changes = nlohmann::json::object();
+  }
+
+  static auto recorded() noexcept { return recording; }
+
+  template <typename T>
+  static auto update(const void * address, const char * key, T && value) -> void
+  {
+    if (recording) {
+      changes[identify(address)][key] = std::forward<decltype(value)>(value);
+    }
+  }
+
+  static auto take() -> nlohmann::json
+  {
+    auto result = nlohmann::json::object();
+    std::swap(result, changes);
+    return result;
+  }
+};
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__CONTEXT_DELTA_HPP_
@@ -15,29 +15,76 @@
 #ifndef OPENSCENARIO_INTERPRETER__DISTRIBUTION_HPP_
 #define OPENSCENARIO_INTERPRETER__DISTRIBUTION_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <random>
+#include <unordered_map>
+#include <vector>
 
 namespace openscenario_interpreter
 {
 inline namespace utility
 {
-// TODO : rename class name
+/* ---- ParameterDistribution --------------------------------------------------
+ *
+ *  A ParameterList is a single assignment of values to the parameters declared
+ *  in the base scenario of a ParameterValueDistribution, and each of them
+ *  results in one concrete scenario. A ParameterDistribution is the whole set
+ *  of assignments that a DistributionDefinition expands to.
+ *
+ *  Values are kept in their external representation because they are written
+ *  back into the ParameterDeclaration of the base scenario as they are.
+ *
+ * -------------------------------------------------------------------------- */
+using ParameterList = std::unordered_map<String, String>;
+
+using ParameterDistribution = std::vector<ParameterList>;
+
+using SingleParameterDistribution = std::vector<String>;
+
+/*
+   NOTE: The random engine is owned by Stochastic and shared by all of its
+   StochasticDistributions. Giving each distribution its own engine seeded with
+   the same randomSeed would make the samples of different parameters
+   correlated.
+*/
 template <typename DistributionT>
 struct StochasticDistributionClass
 {
   template <typename... Ts>
-  StochasticDistributionClass(double random_seed, Ts... xs)
-  : random_engine(random_seed), distribution(xs...)
+  explicit StochasticDistributionClass(Ts... xs) : distribution(xs...)
   {
   }
 
-  std::mt19937 random_engine;
-
   DistributionT distribution;
 
-  auto generate() { return distribution(random_engine); }
+  template <typename RandomEngine>
+  auto generate(RandomEngine & random_engine)
+  {
+    return distribution(random_engine);
+  }
+
+  /*
+     Samples from the distribution truncated to [lower_limit, upper_limit] by
+     rejection. The attempts are bounded so that a Range lying outside of the
+     support of the distribution is reported instead of hanging.
+  */
+  template <typename RandomEngine>
+  auto generate(RandomEngine & random_engine, double lower_limit, double upper_limit)
+  {
+    for (std::size_t attempts = 0; attempts < 10000; ++attempts) {
+      if (const auto value = distribution(random_engine);
+          lower_limit <= value and value <= upper_limit) {
+        return value;
+      }
+    }
+    throw SemanticError(
+      "Failed to sample a value within the range [", lower_limit, ", ", upper_limit,
+      "]. The Range of the distribution is probably out of its support");
+  }
 };
 }  // namespace utility
 }  // namespace openscenario_interpreter
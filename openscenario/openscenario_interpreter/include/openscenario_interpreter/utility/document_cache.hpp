@@ -0,0 +1,66 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__DOCUMENT_CACHE_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__DOCUMENT_CACHE_HPP_
+
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <memory>
+#include <pugixml.hpp>
+#include <scenario_simulator_cache/least_recently_used_cache.hpp>
+#include <string>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/* ---- DocumentCache ----------------------------------------------------------
+ *
+ *  Keeps the XML documents of recently loaded scenario and catalog files
+ *  parsed, so that configuring the interpreter again (e.g. running many
+ *  scenarios sharing the same catalogs) does not parse the same files again.
+ *
+ *  A file is still read on every load, and parsed again unless the hash of
+ *  its contents is the same as the cached one. Unlike comparing the
+ *  modification time (whose resolution may be as coarse as a second), this
+ *  never serves a stale document for a file rewritten right after it was
+ *  loaded. At most `capacity` documents are held, since a sweep or a batch
+ *  run loads many scenarios which are never loaded again.
+ *
+ *  The documents are shared read-only. The syntax tree only refers to their
+ *  nodes and never modifies them, so one document can back any number of
+ *  syntax trees at the same time.
+ *
+ * -------------------------------------------------------------------------- */
+class DocumentCache
+{
+  struct Entry
+  {
+    std::size_t hash;
+
+    std::shared_ptr<const pugi::xml_document> document;
+  };
+
+  static constexpr std::size_t capacity = 256;
+
+  static inline common::LeastRecentlyUsedCache<std::string, Entry> entries{capacity};
+
+public:
+  static auto load(const boost::filesystem::path &) -> std::shared_ptr<const pugi::xml_document>;
+};
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__DOCUMENT_CACHE_HPP_
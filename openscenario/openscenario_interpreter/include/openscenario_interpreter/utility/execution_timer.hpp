@@ -46,11 +46,13 @@ class ExecutionTimer
       std::int64_t diff_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(diff).count();
       count++;
       ns_max = std::max(ns_max, diff_ns);
-      ns_min = std::min(ns_max, diff_ns);
+      ns_min = std::min(ns_min, diff_ns);
       ns_sum += diff_ns;
       ns_square_sum += std::pow(diff_ns, 2);
     }
 
+    auto size() const noexcept { return count; }
+
     template <typename T>
     auto max() const
     {
@@ -15,6 +15,7 @@
 #define OPENSCENARIO_INTERPRETER_NO_EXTENSION
 
 #include <algorithm>
+#include <frame_profiler/frame_profiler.hpp>
 #include <nlohmann/json.hpp>
 #include <openscenario_interpreter/openscenario_interpreter.hpp>
 #include <openscenario_interpreter/record.hpp>
@@ -22,6 +23,7 @@
 #include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
 #include <openscenario_interpreter/syntax/scenario_object.hpp>
+#include <openscenario_interpreter/utility/context_delta.hpp>
 #include <openscenario_interpreter/utility/overload.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 
@@ -35,17 +37,25 @@ namespace openscenario_interpreter
 Interpreter::Interpreter(const rclcpp::NodeOptions & options)
 : rclcpp_lifecycle::LifecycleNode("openscenario_interpreter", options),
   publisher_of_context(create_publisher<Context>("context", rclcpp::QoS(1).transient_local())),
+  batch_mode(false),
+  publish_context_delta(false),
+  context_snapshot_rate(1.0),
+  free_running(false),
   intended_result("success"),
   local_frame_rate(30),
   local_real_time_factor(1.0),
   osc_path(""),
   output_directory("/tmp")
 {
+  DECLARE_PARAMETER(batch_mode);
+  DECLARE_PARAMETER(context_snapshot_rate);
+  DECLARE_PARAMETER(free_running);
   DECLARE_PARAMETER(intended_result);
   DECLARE_PARAMETER(local_frame_rate);
   DECLARE_PARAMETER(local_real_time_factor);
   DECLARE_PARAMETER(osc_path);
   DECLARE_PARAMETER(output_directory);
+  DECLARE_PARAMETER(publish_context_delta);
 }
 
 Interpreter::~Interpreter() { SimulatorCore::deactivate(); }
@@ -74,6 +84,21 @@ auto Interpreter::makeCurrentConfiguration() const -> traffic_simulator::Configu
     logic_file.isDirectory() ? logic_file : logic_file.filepath.parent_path());
   {
     configuration.auto_sink = false;
+    configuration.broadcast_npc_tf = getParameter<bool>("broadcast_npc_tf", true);
+    configuration.entity_status_rate = getParameter<double>("entity_status_rate", 0.0);
+    configuration.free_running = free_running;
+    configuration.port_offset = getParameter<int>("port_offset", 0);
+    configuration.route_cache_capacity = [this]() {
+      if (const auto capacity = getParameter<int>("route_cache_capacity", 4096); 0 < capacity) {
+        return capacity;
+      } else {
+        throw Error(
+          "Parameter route_cache_capacity must be positive, but ", capacity, " was given");
+      }
+    }();
+    configuration.profile = getParameter<bool>("profile", false);
+    configuration.profile_trace_path = getParameter<std::string>("profile_trace_path", "");
+    configuration.waypoint_tolerance = getParameter<double>("waypoint_tolerance", 0.1);
     configuration.scenario_path = osc_path;
 
     // XXX DIRTY HACK!!!
@@ -107,18 +132,31 @@ auto Interpreter::on_configure(const rclcpp_lifecycle::State &) -> Result
 
       std::this_thread::sleep_for(std::chrono::seconds(1));  // NOTE: Wait for parameters to be set.
 
+      GET_PARAMETER(batch_mode);
+      GET_PARAMETER(context_snapshot_rate);
+      GET_PARAMETER(free_running);
       GET_PARAMETER(intended_result);
       GET_PARAMETER(local_frame_rate);
       GET_PARAMETER(local_real_time_factor);
       GET_PARAMETER(osc_path);
       GET_PARAMETER(output_directory);
+      GET_PARAMETER(publish_context_delta);
+
+      if (publish_context_delta and not(0 < context_snapshot_rate)) {
+        throw Error(
+          "Parameter context_snapshot_rate must be positive while publish_context_delta is "
+          "enabled, but ",
+          context_snapshot_rate, " was given");
+      }
 
       script = std::make_shared<OpenScenario>(osc_path);
 
       if (script->category.is<ScenarioDefinition>()) {
         scenarios = {std::dynamic_pointer_cast<ScenarioDefinition>(script->category)};
       } else if (script->category.is<ParameterValueDistribution>()) {
-        throw Error("ParameterValueDistribution is not supported");
+        throw Error(
+          "ParameterValueDistribution cannot be run directly. Give it to scenario_test_runner, "
+          "which expands it into concrete scenarios via openscenario_preprocessor");
       } else {
         throw SyntaxError(
           "Unsupported member of OpenSCENARIOCategory group is defined in the scenario file");
@@ -175,6 +213,8 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
       },
       [this]() {
         withTimeoutHandler(defaultTimeoutHandler(), [this]() {
+          frame_profiler::Zone zone("frame");
+
           if (std::isnan(evaluateSimulationTime())) {
             if (not waiting_for_engagement_to_be_completed and engageable()) {
               engage();
@@ -184,6 +224,7 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
               waiting_for_engagement_to_be_completed = false;  // NOTE: DIRTY HACK!!!
             }
           } else if (currentScenarioDefinition()) {
+            frame_profiler::Zone zone("ScenarioDefinition::evaluate");
             currentScenarioDefinition()->evaluate();
           } else {
             throw Error("No script evaluable.");
@@ -209,9 +250,9 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
         if (getParameter<bool>("record", true)) {
           // clang-format off
           record::start(
-            "-a",
-            "-o", boost::filesystem::path(osc_path).replace_extension("").string(),
-            "-x", "/planning/scenario_planning/lane_driving/behavior_planning/behavior_velocity_planner/debug/intersection");
+            boost::filesystem::path(osc_path).replace_extension("").string(),
+            getParameter<std::string>("record_topics", ".*"),
+            "/planning/scenario_planning/lane_driving/behavior_planning/behavior_velocity_planner/debug/intersection");
           // clang-format on
         }
 
@@ -233,6 +274,14 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
 
         execution_timer.clear();
 
+        /*
+           The first context published after activation is always a snapshot,
+           since subscribers have nothing to apply a delta to yet.
+        */
+        context_snapshot_time = {};
+
+        ContextDelta::record(publish_context_delta);
+
         publisher_of_context->on_activate();
 
         assert(publisher_of_context->is_activated());
@@ -243,7 +292,26 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
           throw Error("No script evaluable.");
         }
 
-        timer = create_wall_timer(currentLocalFrameRate(), evaluate_storyboard);
+        activation_time = std::chrono::steady_clock::now();
+
+        /*
+           In free-running mode, the storyboard is stepped by a zero period
+           timer instead of at local_frame_rate. Each step still advances the
+           simulation time by exactly one frame, so the result of the scenario
+           does not depend on how fast it is run, but the next step starts as
+           soon as the previous one is finished. Stepping from the executor
+           (rather than looping inside a single callback) keeps the node
+           responsive to the lifecycle transitions requested by the
+           scenario_test_runner.
+
+           This is only meaningful for scenarios whose progress is fully
+           determined by the simulator (e.g. NPC-only or standalone-mode
+           scenarios). Autoware runs on its own wall clock timers and cannot
+           follow the simulation time.
+        */
+        timer = create_wall_timer(
+          free_running ? std::chrono::milliseconds(0) : currentLocalFrameRate(),
+          evaluate_storyboard);
 
         return Interpreter::Result::SUCCESS;  // => Active
       });
@@ -266,6 +334,8 @@ auto Interpreter::on_error(const rclcpp_lifecycle::State &) -> Result
 {
   reset();
 
+  SimulatorCore::deactivate();  // NOTE: Do not reuse the simulator core after an error.
+
   return Interpreter::Result::SUCCESS;  // => Unconfigured
 }
 
@@ -276,13 +346,38 @@ auto Interpreter::on_shutdown(const rclcpp_lifecycle::State &) -> Result
   return Interpreter::Result::SUCCESS;  // => Finalized
 }
 
-auto Interpreter::publishCurrentContext() const -> void
+auto Interpreter::publishCurrentContext() -> void
 {
+  frame_profiler::Zone zone("Interpreter::publishCurrentContext");
+
+  /*
+     Serializing the whole syntax tree every frame is often more expensive than
+     evaluating it. When publish_context_delta is set, a full snapshot is
+     published only at context_snapshot_rate, and the frames in between carry
+     only the storyboard element states and condition values that changed
+     since the previous publication (keyed by the "id" field of the snapshot).
+  */
+  const auto snapshot_required = [this]() {
+    return not publish_context_delta or
+           std::chrono::duration<double>(1 / context_snapshot_rate) <=
+             std::chrono::system_clock::now() - context_snapshot_time;
+  };
+
   Context context;
   {
-    nlohmann::json json;
     context.stamp = now();
-    context.data = (json << *script).dump();
+
+    if (snapshot_required()) {
+      nlohmann::json json;
+      ContextDelta::take();  // NOTE: Changes so far are included in the snapshot.
+      context.type = Context::SNAPSHOT;
+      context.data = (json << *script).dump();
+      context_snapshot_time = std::chrono::system_clock::now();
+    } else {
+      context.type = Context::DELTA;
+      context.data = ContextDelta::take().dump();
+    }
+
     context.time = evaluateSimulationTime();
   }
 
@@ -293,11 +388,29 @@ auto Interpreter::reset() -> void
 {
   timer.reset();  // Stop scenario evaluation
 
+  if (const auto steps = execution_timer.getStatistics("").size(); 0 < steps) {
+    const auto elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - activation_time).count();
+    INTERPRETER_INFO_STREAM(
+      "Stepped " << steps << " frames in " << elapsed << " seconds (" << steps / elapsed
+                 << " steps per second, "
+                 << steps / local_frame_rate * local_real_time_factor / elapsed
+                 << " times real time)");
+    execution_timer.clear();
+  }
+
   if (publisher_of_context->is_activated()) {
     publisher_of_context->on_deactivate();
   }
 
-  SimulatorCore::deactivate();
+  /*
+     In batch mode, only the entities, the storyboard and the clock are reset
+     between scenarios; the map, the routing graphs and the connection to the
+     simple_sensor_simulator are reused by the next scenario on the same map.
+  */
+  SimulatorCore::deactivate(batch_mode);
+
+  ContextDelta::record(false);
 
   scenarios.pop_front();
 
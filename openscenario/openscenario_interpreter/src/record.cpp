@@ -12,34 +12,255 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <sys/wait.h>
+#include <rmw/rmw.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
 #include <openscenario_interpreter/record.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <regex>
+#include <rosbag2_cpp/converter_options.hpp>
+#include <rosbag2_cpp/writer.hpp>
+#include <rosbag2_storage/serialized_bag_message.hpp>
+#include <rosbag2_storage/storage_options.hpp>
+#include <rosbag2_storage/topic_metadata.hpp>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace openscenario_interpreter
 {
 namespace record
 {
-pid_t process_id = 0;
-
-auto stop() -> void
+namespace
+{
+class Recorder
 {
-  if (int status = 0; process_id) {
+  const std::regex topics;
+
+  const std::regex excluded_topics;
+
+  const std::size_t queue_size;
+
+  std::mutex writer_mutex;
+
+  rosbag2_cpp::Writer writer;
+
+  const rclcpp::Node::SharedPtr node;
+
+  std::unordered_map<std::string, rclcpp::GenericSubscription::SharedPtr> subscriptions;
+
+  rclcpp::TimerBase::SharedPtr discovery_timer;
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+
+  std::mutex queue_mutex;
+
+  std::condition_variable queue_condition;
+
+  std::deque<std::shared_ptr<rosbag2_storage::SerializedBagMessage>> queue;
+
+  std::size_t dropped_message_count = 0;
+
+  bool stopping = false;
+
+  std::atomic<bool> spinning = true;
+
+  std::thread spinner;
+
+  std::thread worker;
+
+  auto discover() -> void
+  {
+    for (const auto & [topic, types] : node->get_topic_names_and_types()) {
+      if (
+        not types.empty() and subscriptions.find(topic) == std::end(subscriptions) and
+        std::regex_match(topic, topics) and not std::regex_match(topic, excluded_topics)) {
+        subscribe(topic, types.front());
+      }
+    }
+  }
+
+  auto subscribe(const std::string & topic, const std::string & type) -> void
+  {
+    const auto publishers = node->get_publishers_info_by_topic(topic);
+
+    if (publishers.empty()) {
+      return;  // NOTE: Subscribed when a publisher appears, since QoS is adapted to publishers.
+    }
+
+    auto all_publishers = [&](auto && predicate) {
+      return std::all_of(std::begin(publishers), std::end(publishers), [&](auto && publisher) {
+        return predicate(publisher.qos_profile().get_rmw_qos_profile());
+      });
+    };
+
+    /*
+       NOTE: A best effort (volatile) subscription receives messages from any
+       publisher, so reliable (transient local) is requested only if all the
+       publishers offer it, in the same way as ros2 bag record.
+    */
+    auto qos = rclcpp::QoS(rclcpp::KeepLast(100));
+
+    if (all_publishers([](auto && profile) {
+          return profile.reliability == RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+        })) {
+      qos.reliable();
+    } else {
+      qos.best_effort();
+    }
+
+    if (all_publishers([](auto && profile) {
+          return profile.durability == RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+        })) {
+      qos.transient_local();
+    }
+
+    {
+      rosbag2_storage::TopicMetadata metadata;
+      metadata.name = topic;
+      metadata.type = type;
+      metadata.serialization_format = rmw_get_serialization_format();
+      std::lock_guard<std::mutex> lock(writer_mutex);
+      writer.create_topic(metadata);
+    }
+
+    subscriptions.emplace(
+      topic, node->create_generic_subscription(
+               topic, type, qos, [this, topic](std::shared_ptr<rclcpp::SerializedMessage> message) {
+                 push(topic, *message);
+               }));
+  }
+
+  auto push(const std::string & topic, rclcpp::SerializedMessage & message) -> void
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+
+    if (queue_size <= queue.size()) {
+      ++dropped_message_count;
+    } else {
+      auto bag_message = std::make_shared<rosbag2_storage::SerializedBagMessage>();
+      bag_message->topic_name = topic;
+      bag_message->time_stamp = node->now().nanoseconds();
+      bag_message->serialized_data = std::shared_ptr<rcutils_uint8_array_t>(
+        new rcutils_uint8_array_t(message.release_rcl_serialized_message()),
+        [](auto * data) {
+          rcutils_uint8_array_fini(data);
+          delete data;
+        });
+      queue.push_back(std::move(bag_message));
+      queue_condition.notify_one();
+    }
+  }
+
+  auto write() -> void
+  {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+
+    while (true) {
+      queue_condition.wait(lock, [this]() { return stopping or not queue.empty(); });
+
+      if (queue.empty()) {
+        return;
+      } else {
+        std::deque<std::shared_ptr<rosbag2_storage::SerializedBagMessage>> messages;
+        messages.swap(queue);
+        lock.unlock();
+        {
+          std::lock_guard<std::mutex> writer_lock(writer_mutex);
+          for (const auto & message : messages) {
+            writer.write(message);
+          }
+        }
+        lock.lock();
+      }
+    }
+  }
+
+public:
+  explicit Recorder(
+    const std::string & uri, const std::string & topics, const std::string & excluded_topics,
+    std::size_t queue_size)
+  : topics(topics),
+    excluded_topics(excluded_topics),
+    queue_size(queue_size),
+    /*
+       NOTE: Without use_global_arguments(false), the remappings and the node
+       name given to the interpreter on the command line would also apply to
+       this node.
+    */
+    node(std::make_shared<rclcpp::Node>(
+      "openscenario_interpreter_record", rclcpp::NodeOptions().use_global_arguments(false)))
+  {
+    rosbag2_storage::StorageOptions storage_options;
+    storage_options.uri = uri;
+    storage_options.storage_id = "sqlite3";
+
+    writer.open(
+      storage_options, {rmw_get_serialization_format(), rmw_get_serialization_format()});
+
+    discover();
+
+    discovery_timer =
+      node->create_wall_timer(std::chrono::milliseconds(100), [this]() { discover(); });
+
+    executor.add_node(node);
+
     /*
-       NOTE: If the interval between running `record::start(...)` and
-       `record::stop()` is too short, the bag file will not be saved
-       successfully. In such cases, the ros2 bag record command is not
-       recording, but before it, that is, booting. So SIGINT doesn't end the
-       record, it just kills the Python interpreter.
+       NOTE: Not executor.spin(), which never returns if executor.cancel() is
+       called before it starts spinning.
     */
-    std::this_thread::sleep_for(std::chrono::seconds(3));  // DIRTY HACK!!!
+    spinner = std::thread([this]() {
+      while (spinning.load() and rclcpp::ok()) {
+        executor.spin_once(std::chrono::milliseconds(100));
+      }
+    });
+
+    worker = std::thread([this]() { write(); });
+  }
+
+  ~Recorder()
+  {
+    spinning.store(false);
+    spinner.join();
 
-    if (::kill(process_id, SIGINT) or waitpid(process_id, &status, 0) < 0) {
-      std::exit(EXIT_FAILURE);
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      stopping = true;
     }
+    queue_condition.notify_one();
+    worker.join();
+
+    if (dropped_message_count) {
+      std::cerr << "record: " << dropped_message_count
+                << " messages were dropped since the queue was full" << std::endl;
+    }
+  }
+};
+
+std::unique_ptr<Recorder> recorder = nullptr;
+}  // namespace
+
+auto start(
+  const std::string & uri, const std::string & topics, const std::string & excluded_topics,
+  std::size_t queue_size) -> void
+{
+  recorder.reset();
+
+  try {
+    recorder = std::make_unique<Recorder>(uri, topics, excluded_topics, queue_size);
+  } catch (const std::exception & exception) {
+    std::cerr << "record: " << exception.what() << std::endl;
   }
 }
+
+auto stop() -> void { recorder.reset(); }
 }  // namespace record
 }  // namespace openscenario_interpreter
@@ -35,6 +35,8 @@ auto operator<<(nlohmann::json & json, const Act & datum) -> nlohmann::json &
 {
   json["name"] = datum.name;
 
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&datum));
+
   json["currentState"] = boost::lexical_cast<std::string>(datum.state());
 
   json["ManeuverGroup"] = nlohmann::json::array();
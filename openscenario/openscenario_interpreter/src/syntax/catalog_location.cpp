@@ -12,30 +12,64 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <unistd.h>
+
 #include <boost/filesystem.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/catalog.hpp>
 #include <openscenario_interpreter/syntax/catalog_location.hpp>
 #include <openscenario_interpreter/syntax/directory.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <openscenario_interpreter/utility/document_cache.hpp>
+#include <scenario_simulator_cache/fnv1a.hpp>
+#include <sstream>
 
 namespace openscenario_interpreter
 {
 inline namespace syntax
 {
+/*
+   Converting a YAML catalog spawns a Python interpreter, which costs much more
+   than loading the catalog itself. The result of the conversion is cached in
+   a directory named after the hash of the content of the YAML file, so that
+   it is converted only once while the file remains unchanged, no matter how
+   many scenarios refer to it.
+
+   The conversion writes into a directory private to this process, which is
+   then renamed into place. Interpreters running in parallel (e.g. the workers
+   of a ParameterValueDistribution sweep) therefore never observe a partially
+   written catalog.
+*/
 auto convertScenario(
   const boost::filesystem::path & yaml_path, const boost::filesystem::path & output_dir)
 {
+  const auto cache_directory = output_dir / common::fnv1a(yaml_path);
+
+  const auto xosc_path =
+    cache_directory / yaml_path.filename().stem().replace_extension(".xosc");
+
+  if (boost::filesystem::exists(xosc_path)) {
+    return xosc_path;
+  }
+
+  const auto temporary_directory =
+    boost::filesystem::path(cache_directory.string() + "." + std::to_string(::getpid()));
+
   std::stringstream command;
 
   command << "python3 -c \"from openscenario_utility import conversion; conversion.main()\""
           << " --input " << yaml_path  //
-          << " --output " << output_dir;
+          << " --output " << temporary_directory;
 
   if (std::system(command.str().c_str()) != 0) {
     THROW_SYNTAX_ERROR("failed to convert scenario: " + yaml_path.string());
   } else {
-    return output_dir / yaml_path.filename().stem().replace_extension(".xosc");
+    boost::system::error_code error;
+    boost::filesystem::rename(temporary_directory, cache_directory, error);
+    if (error) {  // Another process has converted the same file first.
+      boost::filesystem::remove_all(temporary_directory, error);
+    }
+    return xosc_path;
   }
 }
 
@@ -56,9 +90,7 @@ CatalogLocation::CatalogLocation(const pugi::xml_node & node, Scope & scope)
     } else if (path.extension() != ".xosc") {
       continue;
     }
-    auto new_document = std::make_shared<pugi::xml_document>();
-    new_document->load_file(path.string().c_str());
-    catalog_files.emplace_back(std::move(new_document));
+    catalog_files.push_back(DocumentCache::load(path));
   }
 
   for (auto && xml : catalog_files) {
@@ -17,6 +17,7 @@
 #include <openscenario_interpreter/syntax/by_entity_condition.hpp>
 #include <openscenario_interpreter/syntax/by_value_condition.hpp>
 #include <openscenario_interpreter/syntax/condition.hpp>
+#include <openscenario_interpreter/utility/context_delta.hpp>
 #include <openscenario_interpreter/utility/demangle.hpp>
 
 namespace openscenario_interpreter
@@ -46,12 +47,22 @@ auto Condition::evaluate() -> Object
   if (condition_edge == ConditionEdge::sticky and current_value) {
     return true_v;
   } else {
-    return asBoolean(current_value = Object::evaluate().as<Boolean>());
+    const auto previous_value = std::exchange(current_value, Object::evaluate().as<Boolean>());
+
+    if (current_value != previous_value and ContextDelta::recorded()) {
+      ContextDelta::update(
+        this, "currentValue", boost::lexical_cast<std::string>(Boolean(current_value)));
+      ContextDelta::update(this, "currentEvaluation", description());
+    }
+
+    return asBoolean(current_value);
   }
 }
 
 auto operator<<(nlohmann::json & json, const Condition & datum) -> nlohmann::json &
 {
+  json["id"] = ContextDelta::identify(&datum);
+
   json["currentEvaluation"] = datum.description();
 
   json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
@@ -14,6 +14,7 @@
 
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/condition_group.hpp>
+#include <openscenario_interpreter/utility/context_delta.hpp>
 
 namespace openscenario_interpreter
 {
@@ -27,16 +28,26 @@ ConditionGroup::ConditionGroup(const pugi::xml_node & node, Scope & scope) : cur
 auto ConditionGroup::evaluate() -> Object
 {
   // NOTE: Don't use std::all_of; Intentionally does not short-circuit evaluation.
-  return asBoolean(
-    current_value = std::accumulate(
-      std::begin(*this), std::end(*this), true, [&](auto && lhs, Condition & condition) {
-        const auto rhs = condition.evaluate();
-        return lhs and rhs.as<Boolean>();
-      }));
+  const auto previous_value = current_value;
+
+  current_value = std::accumulate(
+    std::begin(*this), std::end(*this), true, [&](auto && lhs, Condition & condition) {
+      const auto rhs = condition.evaluate();
+      return lhs and rhs.as<Boolean>();
+    });
+
+  if (current_value != previous_value and ContextDelta::recorded()) {
+    ContextDelta::update(
+      this, "currentValue", boost::lexical_cast<std::string>(Boolean(current_value)));
+  }
+
+  return asBoolean(current_value);
 }
 
 auto operator<<(nlohmann::json & json, const ConditionGroup & datum) -> nlohmann::json &
 {
+  json["id"] = ContextDelta::identify(&datum);
+
   json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
 
   json["Condition"] = nlohmann::json::array();
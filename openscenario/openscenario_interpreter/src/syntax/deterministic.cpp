@@ -24,5 +24,30 @@ Deterministic::Deterministic(const pugi::xml_node & node, Scope & scope)
     readGroups<DeterministicParameterDistribution, 0>(node, scope))
 {
 }
+
+auto Deterministic::derive() -> ParameterDistribution
+{
+  /*
+     Each DeterministicParameterDistribution varies its own parameters
+     independently of the others, so the result is the cartesian product of
+     all of them. An empty Deterministic derives the base scenario as it is.
+  */
+  ParameterDistribution result{ParameterList()};
+
+  for (auto && deterministic_parameter_distribution : deterministic_parameter_distributions) {
+    ParameterDistribution product;
+    for (auto && parameters : apply<ParameterDistribution>(
+           [](auto && distribution) { return distribution.derive(); },
+           deterministic_parameter_distribution)) {
+      for (const auto & each : result) {
+        product.push_back(each);
+        product.back().insert(std::begin(parameters), std::end(parameters));
+      }
+    }
+    result = std::move(product);
+  }
+
+  return result;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
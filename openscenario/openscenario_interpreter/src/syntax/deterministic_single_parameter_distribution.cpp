@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution.hpp>
 
@@ -21,8 +22,19 @@ inline namespace syntax
 {
 DeterministicSingleParameterDistribution::DeterministicSingleParameterDistribution(
   const pugi::xml_node & node, Scope & scope)
-: DeterministicSingleParameterDistributionType(node, scope)
+: DeterministicSingleParameterDistributionType(node, scope),
+  parameter_name(readAttribute<String>("parameterName", node, scope))
 {
 }
+
+auto DeterministicSingleParameterDistribution::derive() -> ParameterDistribution
+{
+  ParameterDistribution result;
+  for (auto && value : apply<SingleParameterDistribution>(
+         [](auto && distribution) { return distribution.derive(); }, *this)) {
+    result.push_back({{parameter_name, value}});
+  }
+  return result;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
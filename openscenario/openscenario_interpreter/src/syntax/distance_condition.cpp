@@ -42,7 +42,8 @@ DistanceCondition::DistanceCondition(
   value(readAttribute<Double>("value", node, scope)),
   position(readElement<Position>("Position", node, scope)),
   triggering_entities(triggering_entities),
-  results(triggering_entities.entity_refs.size(), Double::nan())
+  results(triggering_entities.entity_refs.size(), Double::nan()),
+  specialized_distance(specialize(coordinate_system, relative_distance_type, freespace))
 {
 }
 
@@ -59,7 +60,7 @@ auto DistanceCondition::description() const -> std::string
   return description.str();
 }
 
-#define DISTANCE(...) distance<__VA_ARGS__>(triggering_entity)
+#define DISTANCE(...) &DistanceCondition::distance<__VA_ARGS__>
 
 #define SWITCH_FREESPACE(FUNCTION, ...) \
   return freespace ? FUNCTION(__VA_ARGS__, true) : FUNCTION(__VA_ARGS__, false)
@@ -95,10 +96,17 @@ auto DistanceCondition::description() const -> std::string
 
 #define APPLY(F, ...) F(__VA_ARGS__)
 
-auto DistanceCondition::distance(const EntityRef & triggering_entity) const -> double
+auto DistanceCondition::specialize(
+  const CoordinateSystem & coordinate_system, const RelativeDistanceType & relative_distance_type,
+  const Boolean & freespace) -> Distance
 {
   APPLY(SWITCH_COORDINATE_SYSTEM, SWITCH_RELATIVE_DISTANCE_TYPE, SWITCH_FREESPACE, DISTANCE);
-  return std::numeric_limits<double>::quiet_NaN();
+  throw UNEXPECTED_ENUMERATION_VALUE_ASSIGNED(CoordinateSystem, coordinate_system);
+}
+
+auto DistanceCondition::distance(const EntityRef & triggering_entity) const -> double
+{
+  return (this->*specialized_distance)(triggering_entity);
 }
 
 template <>
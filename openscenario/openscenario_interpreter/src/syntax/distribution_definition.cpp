@@ -28,5 +28,11 @@ DistributionDefinition::DistributionDefinition(const pugi::xml_node & tree, Scop
 // clang-format on
 {
 }
+
+auto DistributionDefinition::derive() -> ParameterDistribution
+{
+  return apply<ParameterDistribution>(
+    [](auto && distribution) { return distribution.derive(); }, *this);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/distribution_range.hpp>
 
@@ -20,9 +23,37 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 DistributionRange::DistributionRange(const pugi::xml_node & node, Scope & scope)
-: Scope(scope), range(readElement<Range>("Range", node, local()))
+: Scope(scope),
+  step_width(readAttribute<Double>("stepWidth", node, local())),
+  range(readElement<Range>("Range", node, local()))
 {
 }
 
+auto DistributionRange::derive() const -> SingleParameterDistribution
+{
+  if (not(0 < step_width.data) or range.upper_limit.data < range.lower_limit.data) {
+    throw SemanticError(
+      "DistributionRange requires stepWidth > 0 and lowerLimit <= upperLimit, but stepWidth = ",
+      step_width, ", lowerLimit = ", range.lower_limit, ", upperLimit = ", range.upper_limit,
+      " were given");
+  }
+
+  /*
+     NOTE: Each value is computed from the lower limit instead of being
+     accumulated, and the number of steps is rounded with a small tolerance, so
+     that a stepWidth without an exact binary representation (e.g. 0.1) does
+     not drop the upper limit.
+  */
+  const auto steps = static_cast<std::size_t>(
+    std::floor((range.upper_limit.data - range.lower_limit.data) / step_width.data + 1e-6));
+
+  SingleParameterDistribution values;
+  for (std::size_t i = 0; i <= steps; ++i) {
+    values.push_back(
+      boost::lexical_cast<String>(Double(range.lower_limit.data + step_width.data * i)));
+  }
+  return values;
+}
+
 }  // namespace syntax
 }  // namespace openscenario_interpreter
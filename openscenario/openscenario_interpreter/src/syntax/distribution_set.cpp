@@ -23,5 +23,14 @@ DistributionSet::DistributionSet(const pugi::xml_node & node, Scope & scope)
 : Scope(scope), elements(readElements<DistributionSetElement, 1>("Element", node, local()))
 {
 }
+
+auto DistributionSet::derive() const -> SingleParameterDistribution
+{
+  SingleParameterDistribution values;
+  for (const auto & element : elements) {
+    values.push_back(element.value);
+  }
+  return values;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
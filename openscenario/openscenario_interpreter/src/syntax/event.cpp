@@ -59,6 +59,8 @@ auto operator<<(nlohmann::json & json, const Event & datum) -> nlohmann::json &
 {
   json["name"] = datum.name;
 
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&datum));
+
   json["currentState"] = boost::lexical_cast<std::string>(datum.state());
 
   json["currentExecutionCount"] = datum.current_execution_count;
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/histogram.hpp>
 
@@ -23,9 +24,13 @@ Histogram::Histogram(const pugi::xml_node & node, openscenario_interpreter::Scop
 : bins(readElements<HistogramBin, 1>("Bin", node, scope)),
   bin_adaptor(bins),
   distribution(
-    scope.ref<Double>(std::string("randomSeed")).data, bin_adaptor.intervals.begin(),
-    bin_adaptor.intervals.end(), bin_adaptor.densities.begin())
+    bin_adaptor.intervals.begin(), bin_adaptor.intervals.end(), bin_adaptor.densities.begin())
 {
 }
+
+auto Histogram::derive(std::mt19937 & random_engine) -> String
+{
+  return boost::lexical_cast<String>(Double(distribution.generate(random_engine)));
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
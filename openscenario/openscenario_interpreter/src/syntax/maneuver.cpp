@@ -53,6 +53,8 @@ auto operator<<(nlohmann::json & json, const Maneuver & maneuver) -> nlohmann::j
 {
   json["name"] = maneuver.name;
 
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&maneuver));
+
   json["currentState"] = boost::lexical_cast<std::string>(maneuver.state());
 
   json["Event"] = nlohmann::json::array();
@@ -48,6 +48,8 @@ auto operator<<(nlohmann::json & json, const ManeuverGroup & maneuver_group) ->
 {
   json["name"] = maneuver_group.name;
 
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&maneuver_group));
+
   json["currentState"] = boost::lexical_cast<std::string>(maneuver_group.state());
 
   json["currentExecutionCount"] = maneuver_group.current_execution_count;
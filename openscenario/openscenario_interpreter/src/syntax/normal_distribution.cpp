@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/normal_distribution.hpp>
 
@@ -21,13 +24,18 @@ inline namespace syntax
 {
 NormalDistribution::NormalDistribution(
   const pugi::xml_node & node, openscenario_interpreter::Scope & scope)
-: range(readElement<Range>("range", node, scope)),
+: range(readElement<Range>("Range", node, scope)),
   expected_value(readAttribute<Double>("expectedValue", node, scope)),
   variance(readAttribute<Double>("variance", node, scope)),
   distribution(
-    scope.ref<Double>(std::string("randomSeed")).data, static_cast<double>(expected_value.data),
-    static_cast<double>(variance.data))
+    static_cast<double>(expected_value.data), std::sqrt(static_cast<double>(variance.data)))
 {
 }
+
+auto NormalDistribution::derive(std::mt19937 & random_engine) -> String
+{
+  return boost::lexical_cast<String>(Double(
+    distribution.generate(random_engine, range.lower_limit.data, range.upper_limit.data)));
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
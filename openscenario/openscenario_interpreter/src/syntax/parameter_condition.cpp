@@ -62,17 +62,30 @@ auto ParameterCondition::description() const -> String
 {
   std::stringstream description;
 
-  description << "The value of parameter " << std::quoted(parameter_ref) << " = "
-              << local().ref(parameter_ref) << " " << rule << " " << value << "?";
+  description << "The value of parameter " << std::quoted(parameter_ref) << " = " << resolve()
+              << " " << rule << " " << value << "?";
 
   return description.str();
 }
 
+auto ParameterCondition::resolve() const -> const Object &
+{
+  /*
+     Parameters are never rebound after their declaration (ParameterSetAction
+     and ParameterModifyAction modify the bound object in place), so the object
+     found by the first lookup is the one every later lookup would find.
+  */
+  if (not parameter) {
+    parameter = local().ref(parameter_ref);
+  }
+
+  return parameter;
+}
+
 auto ParameterCondition::evaluate() const -> Object
 {
   try {
-    const auto parameter = local().ref(parameter_ref);
-    if (not parameter) {
+    if (not resolve()) {
       THROW_SYNTAX_ERROR(parameter_ref, " cannot be found from this scope");
     } else {
       return asBoolean(compare(parameter, rule, value));
@@ -34,11 +34,13 @@ auto ParameterModifyAction::run() noexcept -> void {}
 auto ParameterModifyAction::start() const -> void
 {
   try {
-    const auto target = local().ref(parameter_ref);
+    if (not parameter) {
+      parameter = local().ref(parameter_ref);
+    }
     if (rule.is<ParameterAddValueRule>()) {
-      rule.as<ParameterAddValueRule>()(target);
+      rule.as<ParameterAddValueRule>()(parameter);
     } else {
-      rule.as<ParameterMultiplyByValueRule>()(target);
+      rule.as<ParameterMultiplyByValueRule>()(parameter);
     }
   } catch (const std::out_of_range &) {
     throw SemanticError("No such parameter ", std::quoted(parameter_ref));
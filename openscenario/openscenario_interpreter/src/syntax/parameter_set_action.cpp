@@ -34,8 +34,7 @@ auto ParameterSetAction::accomplished() noexcept -> bool  //
 
 auto ParameterSetAction::run() noexcept -> void {}
 
-auto ParameterSetAction::set(
-  const Scope & scope, const String & parameter_ref, const String & value) -> void
+auto ParameterSetAction::set(const Object & parameter, const String & value) -> void
 {
   static const std::unordered_map<
     std::type_index, std::function<void(const Object &, const String &)>>
@@ -50,14 +49,22 @@ auto ParameterSetAction::set(
       // clang-format on
     };
 
-  const auto parameter = scope.ref(parameter_ref);
-
   overloads.at(parameter.type())(parameter, value);
 }
 
-auto ParameterSetAction::start() const -> void  //
+auto ParameterSetAction::set(
+  const Scope & scope, const String & parameter_ref, const String & value) -> void
 {
-  set(local(), parameter_ref, value);
+  set(scope.ref(parameter_ref), value);
+}
+
+auto ParameterSetAction::start() const -> void
+{
+  if (not parameter) {
+    parameter = local().ref(parameter_ref);
+  }
+
+  set(parameter, value);
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
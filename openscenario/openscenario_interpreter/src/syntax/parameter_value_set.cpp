@@ -25,5 +25,14 @@ ParameterValueSet::ParameterValueSet(
   parameter_assignments(readElements<ParameterAssignment, 1>("ParameterAssignment", node, local()))
 {
 }
+
+auto ParameterValueSet::derive() const -> ParameterList
+{
+  ParameterList parameters;
+  for (const auto & parameter_assignment : parameter_assignments) {
+    parameters.emplace(parameter_assignment.parameterRef, parameter_assignment.value);
+  }
+  return parameters;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
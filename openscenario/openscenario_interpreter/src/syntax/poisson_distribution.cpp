@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/poisson_distribution.hpp>
 
@@ -21,10 +23,16 @@ inline namespace syntax
 {
 PoissonDistribution::PoissonDistribution(
   const pugi::xml_node & node, openscenario_interpreter::Scope & scope)
-: range(readElement<Range>("range", node, scope)),
+: range(readElement<Range>("Range", node, scope)),
   expected_value(readAttribute<Double>("expectedValue", node, scope)),
-  distribution(scope.ref<Double>(std::string("randomSeed")).data, expected_value.data)
+  distribution(expected_value.data)
 {
 }
+
+auto PoissonDistribution::derive(std::mt19937 & random_engine) -> String
+{
+  return boost::lexical_cast<String>(
+    distribution.generate(random_engine, range.lower_limit.data, range.upper_limit.data));
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -23,10 +23,13 @@ ProbabilityDistributionSet::ProbabilityDistributionSet(
   const pugi::xml_node & node, openscenario_interpreter::Scope & scope)
 : elements(readElements<ProbabilityDistributionSetElement, 1>("Element", node, scope)),
   adaptor(elements),
-  distribution(
-    scope.ref<Double>(std::string("randomSeed")).data, adaptor.probabilities.begin(),
-    adaptor.probabilities.end())
+  distribution(adaptor.probabilities.begin(), adaptor.probabilities.end())
 {
 }
+
+auto ProbabilityDistributionSet::derive(std::mt19937 & random_engine) -> String
+{
+  return adaptor.values.at(distribution.generate(random_engine));
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
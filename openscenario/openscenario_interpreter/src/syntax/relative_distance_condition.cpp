@@ -36,7 +36,8 @@ RelativeDistanceCondition::RelativeDistanceCondition(
   rule(readAttribute<Rule>("rule", node, scope)),
   value(readAttribute<Double>("value", node, scope)),
   triggering_entities(triggering_entities),
-  results(triggering_entities.entity_refs.size(), Double::nan())
+  results(triggering_entities.entity_refs.size(), Double::nan()),
+  specialized_distance(specialize(coordinate_system, relative_distance_type, freespace))
 {
 }
 
@@ -126,7 +127,7 @@ auto RelativeDistanceCondition::distance<
   }
 }
 
-#define DISTANCE(...) distance<__VA_ARGS__>(triggering_entity)
+#define DISTANCE(...) &RelativeDistanceCondition::distance<__VA_ARGS__>
 
 #define SWITCH_FREESPACE(FUNCTION, ...) \
   return freespace ? FUNCTION(__VA_ARGS__, true) : FUNCTION(__VA_ARGS__, false)
@@ -162,10 +163,17 @@ auto RelativeDistanceCondition::distance<
 
 #define APPLY(F, ...) F(__VA_ARGS__)
 
-auto RelativeDistanceCondition::distance(const EntityRef & triggering_entity) -> double
+auto RelativeDistanceCondition::specialize(
+  const CoordinateSystem & coordinate_system, const RelativeDistanceType & relative_distance_type,
+  const Boolean & freespace) -> Distance
 {
   APPLY(SWITCH_COORDINATE_SYSTEM, SWITCH_RELATIVE_DISTANCE_TYPE, SWITCH_FREESPACE, DISTANCE);
-  return Double::nan();
+  throw UNEXPECTED_ENUMERATION_VALUE_ASSIGNED(CoordinateSystem, coordinate_system);
+}
+
+auto RelativeDistanceCondition::distance(const EntityRef & triggering_entity) -> double
+{
+  return (this->*specialized_distance)(triggering_entity);
 }
 
 auto RelativeDistanceCondition::evaluate() -> Object
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/stochastic.hpp>
 
@@ -20,11 +22,28 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 Stochastic::Stochastic(const pugi::xml_node & node, Scope & scope)
-: stochastic_distribution(
-    readElement<StochasticDistribution>("StochasticDistribution", node, scope)),
+: stochastic_distributions(
+    readElements<StochasticDistribution, 1>("StochasticDistribution", node, scope)),
   number_of_test_runs(readAttribute<UnsignedInt>("numberOfTestRuns", node, scope)),
-  random_seed(readAttribute<Double>("randomSeed", node, scope))
+  random_seed(readAttribute<Double>("randomSeed", node, scope, Double::nan())),
+  random_engine(
+    std::isnan(random_seed.data) ? std::random_device()()
+                                 : static_cast<std::mt19937::result_type>(random_seed.data))
 {
 }
+
+auto Stochastic::derive() -> ParameterDistribution
+{
+  ParameterDistribution result;
+  for (std::size_t i = 0; i < number_of_test_runs; ++i) {
+    ParameterList parameters;
+    for (auto && stochastic_distribution : stochastic_distributions) {
+      parameters.emplace(
+        stochastic_distribution.parameter_name, stochastic_distribution.derive(random_engine));
+    }
+    result.push_back(std::move(parameters));
+  }
+  return result;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
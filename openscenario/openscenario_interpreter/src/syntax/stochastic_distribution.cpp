@@ -24,5 +24,11 @@ StochasticDistribution::StochasticDistribution(const pugi::xml_node & node, Scop
   parameter_name(readAttribute<String>("parameterName", node, scope))
 {
 }
+
+auto StochasticDistribution::derive(std::mt19937 & random_engine) -> String
+{
+  return apply<String>(
+    [&](auto && distribution) { return distribution.derive(random_engine); }, *this);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
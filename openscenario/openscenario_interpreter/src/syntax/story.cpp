@@ -38,6 +38,8 @@ auto operator<<(nlohmann::json & json, const Story & story) -> nlohmann::json &
 {
   json["name"] = story.name;
 
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&story));
+
   json["currentState"] = boost::lexical_cast<std::string>(story.state());
 
   json["Act"] = nlohmann::json::array();
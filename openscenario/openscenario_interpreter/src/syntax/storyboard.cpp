@@ -51,6 +51,8 @@ auto Storyboard::run() -> void
 
 auto operator<<(nlohmann::json & json, const Storyboard & datum) -> nlohmann::json &
 {
+  json["id"] = ContextDelta::identify(static_cast<const StoryboardElement *>(&datum));
+
   json["currentState"] = boost::lexical_cast<std::string>(datum.state());
 
   json["Init"] << datum.init;
@@ -14,6 +14,7 @@
 
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/trigger.hpp>
+#include <openscenario_interpreter/utility/context_delta.hpp>
 
 namespace openscenario_interpreter
 {
@@ -35,17 +36,26 @@ auto Trigger::evaluate() -> Object
    *
    * ---------------------------------------------------------------------- */
   // NOTE: Don't use std::any_of; Intentionally does not short-circuit evaluation.
-  return asBoolean(
-    current_value = std::accumulate(
-      std::begin(*this), std::end(*this), false,
-      [&](auto && lhs, ConditionGroup & condition_group) {
-        const auto rhs = condition_group.evaluate();
-        return lhs or rhs.as<Boolean>();
-      }));
+  const auto previous_value = current_value;
+
+  current_value = std::accumulate(
+    std::begin(*this), std::end(*this), false, [&](auto && lhs, ConditionGroup & condition_group) {
+      const auto rhs = condition_group.evaluate();
+      return lhs or rhs.as<Boolean>();
+    });
+
+  if (current_value != previous_value and ContextDelta::recorded()) {
+    ContextDelta::update(
+      this, "currentValue", boost::lexical_cast<std::string>(Boolean(current_value)));
+  }
+
+  return asBoolean(current_value);
 }
 
 auto operator<<(nlohmann::json & json, const Trigger & datum) -> nlohmann::json &
 {
+  json["id"] = ContextDelta::identify(&datum);
+
   json["currentValue"] = boost::lexical_cast<std::string>(Boolean(datum.current_value));
 
   json["ConditionGroup"] = nlohmann::json::array();
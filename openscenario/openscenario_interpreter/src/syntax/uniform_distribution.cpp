@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/uniform_distribution.hpp>
 
@@ -21,11 +22,14 @@ inline namespace syntax
 {
 UniformDistribution::UniformDistribution(
   const pugi::xml_node & node, openscenario_interpreter::Scope & scope)
-: range(readElement<Range>("range", node, scope)),
-  distribution(
-    scope.ref<Double>(std::string("randomSeed")).data, range.lower_limit.data,
-    range.upper_limit.data)
+: range(readElement<Range>("Range", node, scope)),
+  distribution(range.lower_limit.data, range.upper_limit.data)
 {
 }
+
+auto UniformDistribution::derive(std::mt19937 & random_engine) -> String
+{
+  return boost::lexical_cast<String>(Double(distribution.generate(random_engine)));
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
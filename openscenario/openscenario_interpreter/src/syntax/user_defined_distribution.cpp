@@ -26,5 +26,15 @@ UserDefinedDistribution::UserDefinedDistribution(const pugi::xml_node & node, co
   content(readContent<String>(node, local()))
 {
 }
+
+auto UserDefinedDistribution::derive() const -> SingleParameterDistribution
+{
+  throw UNSUPPORTED_SETTING_DETECTED(UserDefinedDistribution, type);
+}
+
+auto UserDefinedDistribution::derive(std::mt19937 &) const -> String
+{
+  throw UNSUPPORTED_SETTING_DETECTED(UserDefinedDistribution, type);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -25,5 +25,14 @@ ValueSetDistribution::ValueSetDistribution(
   parameter_value_sets(readElements<ParameterValueSet, 1>("ParameterValueSet", node, scope))
 {
 }
+
+auto ValueSetDistribution::derive() const -> ParameterDistribution
+{
+  ParameterDistribution result;
+  for (const auto & parameter_value_set : parameter_value_sets) {
+    result.push_back(parameter_value_set.derive());
+  }
+  return result;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
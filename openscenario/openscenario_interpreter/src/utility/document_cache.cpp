@@ -0,0 +1,56 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/document_cache.hpp>
+#include <string>
+#include <string_view>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+auto DocumentCache::load(const boost::filesystem::path & pathname)
+  -> std::shared_ptr<const pugi::xml_document>
+{
+  if (not boost::filesystem::exists(pathname)) {
+    throw SyntaxError("File was not found: ", pathname);
+  }
+
+  const auto canonical_pathname = boost::filesystem::canonical(pathname).string();
+
+  std::ifstream ifs(canonical_pathname, std::ios::binary);
+
+  const auto contents =
+    std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+  const auto hash = std::hash<std::string_view>()(contents);
+
+  if (const auto entry = entries.find(canonical_pathname); entry and entry->hash == hash) {
+    return entry->document;
+  } else {
+    auto document = std::make_shared<pugi::xml_document>();
+    if (const auto result = document->load_buffer(contents.data(), contents.size()); not result) {
+      throw SyntaxError(result.description(), ": ", pathname);
+    } else {
+      entries.insert(canonical_pathname, Entry{hash, document});
+      return document;
+    }
+  }
+}
+}  // namespace utility
+}  // namespace openscenario_interpreter
@@ -15,15 +15,46 @@
 #include <gtest/gtest.h>
 
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <memory>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <openscenario_interpreter/utility/document_cache.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <thread>
 
 TEST(syntax, dummy) { ASSERT_TRUE(true); }
 
+TEST(DocumentCache, ReloadFileRewrittenWithSameSize)
+{
+  using openscenario_interpreter::DocumentCache;
+
+  const auto path =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.xosc");
+
+  auto write = [&](const auto & value) {
+    std::ofstream(path.string()) << "<Parameter value=\"" << value << "\"/>";
+  };
+
+  auto value_of = [](const auto & document) {
+    return std::string(document->child("Parameter").attribute("value").value());
+  };
+
+  write(1);
+  const auto first = DocumentCache::load(path);
+  EXPECT_EQ(value_of(first), "1");
+  EXPECT_EQ(DocumentCache::load(path), first);
+
+  write(2);  // NOTE: Within the resolution of the modification time, and of the same size.
+  const auto second = DocumentCache::load(path);
+  EXPECT_EQ(value_of(second), "2");
+  EXPECT_EQ(DocumentCache::load(path), second);
+
+  boost::filesystem::remove(path);
+}
+
 // TEST(Syntax, LexicalScope)
 // {
 //   using ament_index_cpp::get_package_share_directory;
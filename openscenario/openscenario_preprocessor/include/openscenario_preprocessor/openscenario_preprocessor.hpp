@@ -19,6 +19,7 @@
 #include <deque>
 #include <memory>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <openscenario_interpreter/utility/distribution.hpp>
 #include <openscenario_preprocessor_msgs/srv/check_derivative_remained.hpp>
 #include <openscenario_preprocessor_msgs/srv/derive.hpp>
 #include <openscenario_preprocessor_msgs/srv/load.hpp>
@@ -63,6 +64,12 @@ private:
 
   [[nodiscard]] bool validateXOSC(const boost::filesystem::path &, bool);
 
+  void embedParameters(
+    const boost::filesystem::path &, const openscenario_interpreter::ParameterList &,
+    const boost::filesystem::path &);
+
+  std::string output_directory;
+
   rclcpp::Service<openscenario_preprocessor_msgs::srv::Load>::SharedPtr load_server;
 
   rclcpp::Service<openscenario_preprocessor_msgs::srv::Derive>::SharedPtr derive_server;
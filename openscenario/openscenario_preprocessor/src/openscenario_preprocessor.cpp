@@ -15,15 +15,19 @@
 //#define OPENSCENARIO_INTERPRETER_NO_EXTENSION
 
 #include <algorithm>
+#include <functional>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
 #include <openscenario_preprocessor/openscenario_preprocessor.hpp>
+#include <pugixml.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 
 namespace openscenario_preprocessor
 {
 Preprocessor::Preprocessor(const rclcpp::NodeOptions & options)
-: rclcpp::Node("preprocessor", options)
+: rclcpp::Node("preprocessor", options),
+  output_directory(
+    declare_parameter<std::string>("output_directory", "/tmp/openscenario_preprocessor"))
 {
   using openscenario_preprocessor_msgs::srv::Load;
   load_server = create_service<Load>(
@@ -84,24 +88,41 @@ void Preprocessor::preprocessScenario(ScenarioSet & scenario)
   if (validateXOSC(scenario.path)) {
     if (auto script = std::make_shared<OpenScenario>(scenario.path);
         script->category.is<ParameterValueDistribution>()) {
-      std::cout << "ParameterValueDistribution!!" << std::endl;
-      auto base_scenario_path =
-        script->category.as<ParameterValueDistribution>().scenario_file.filepath;
+      auto & parameter_value_distribution = script->category.as<ParameterValueDistribution>();
+      auto base_scenario_path = parameter_value_distribution.scenario_file.filepath;
       std::cout << "base_scenario_path : " << base_scenario_path << std::endl;
       if (boost::filesystem::exists(base_scenario_path)) {
         if (validateXOSC(base_scenario_path, true)) {
-          // TODO : implement in feature/parameter_value_distribution branch
-          //
-          //  parameters = evaluate( parameter_value_distribution( given scenario ) )
-          //  for( auto derived_scenario : embedParameter( linked scenario, parameters)
-          //    preprocessed_scenarios.emplace_back({derived_scenario, derive_server});
+          /*
+             Each derived scenario is written to its own file so that it can be
+             run by an independent interpreter process. They are named after the
+             distribution file, which is what the junit test suite is named
+             after.
+          */
+          const auto derived_scenario_directory =
+            boost::filesystem::path(output_directory) /
+            boost::filesystem::path(scenario.path).stem();
+          boost::filesystem::create_directories(derived_scenario_directory);
+
+          const auto parameter_distribution = parameter_value_distribution.derive();
+          for (std::size_t index = 0; index < parameter_distribution.size(); ++index) {
+            auto derived_scenario = scenario;
+            derived_scenario.path =
+              (derived_scenario_directory / (base_scenario_path.stem().string() + "." +
+                                             std::to_string(index) + ".xosc"))
+                .string();
+            embedParameters(
+              base_scenario_path, parameter_distribution[index], derived_scenario.path);
+            preprocessed_scenarios.push_back(derived_scenario);
+          }
+          std::cout << "derived " << parameter_distribution.size() << " scenarios into "
+                    << derived_scenario_directory << std::endl;
         } else {
           throw common::Error("base scenario is not valid : " + base_scenario_path.string());
         }
       } else {
         throw common::Error("base scenario does not exist : " + base_scenario_path.string());
       }
-      std::cout << "base scenario is valid!" << std::endl;
 
     } else {
       // normal scenario
@@ -111,6 +132,66 @@ void Preprocessor::preprocessScenario(ScenarioSet & scenario)
     throw common::Error("the scenario file is not valid. Please check your scenario");
   }
 }
+
+void Preprocessor::embedParameters(
+  const boost::filesystem::path & base_scenario_path,
+  const openscenario_interpreter::ParameterList & parameters,
+  const boost::filesystem::path & derived_scenario_path)
+{
+  pugi::xml_document document;
+
+  if (not document.load_file(base_scenario_path.c_str())) {
+    throw common::Error("failed to load base scenario : " + base_scenario_path.string());
+  }
+
+  /*
+     A ParameterValueDistribution overrides the values of the global
+     ParameterDeclarations of the base scenario. Assigning to a parameter the
+     base scenario does not declare is a mistake in the distribution, so it is
+     reported rather than silently ignored.
+  */
+  auto parameter_declarations = document.child("OpenSCENARIO").child("ParameterDeclarations");
+
+  for (const auto & [name, value] : parameters) {
+    if (auto parameter_declaration = parameter_declarations.find_child_by_attribute(
+          "ParameterDeclaration", "name", name.c_str())) {
+      parameter_declaration.attribute("value").set_value(value.c_str());
+    } else {
+      throw common::Error(
+        "parameter " + name + " is not declared in base scenario : " +
+        base_scenario_path.string());
+    }
+  }
+
+  /*
+     The derived scenario lives in another directory than the base scenario,
+     so $(dirname) is resolved here against the directory of the base scenario
+     to keep the relative references of the base scenario working.
+  */
+  const auto dirname = boost::filesystem::absolute(base_scenario_path).parent_path().string();
+
+  std::function<void(const pugi::xml_node &)> substitute_dirname = [&](const auto & node) {
+    static const std::string pattern = "$(dirname)";
+    for (auto attribute : node.attributes()) {
+      if (std::string value = attribute.value(); value.find(pattern) != std::string::npos) {
+        for (auto position = value.find(pattern); position != std::string::npos;
+             position = value.find(pattern, position + dirname.size())) {
+          value.replace(position, pattern.size(), dirname);
+        }
+        attribute.set_value(value.c_str());
+      }
+    }
+    for (const auto & child : node.children()) {
+      substitute_dirname(child);
+    }
+  };
+
+  substitute_dirname(document);
+
+  if (not document.save_file(derived_scenario_path.c_str())) {
+    throw common::Error("failed to write derived scenario : " + derived_scenario_path.string());
+  }
+}
 }  // namespace openscenario_preprocessor
 
 RCLCPP_COMPONENTS_REGISTER_NODE(openscenario_preprocessor::Preprocessor)
@@ -20,11 +20,13 @@
 #endif
 
 #include <mutex>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter_msgs/msg/context.hpp>
 #include <openscenario_visualization/context_panel_plugin.hpp>
 #include <rviz_common/panel.hpp>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace Ui
@@ -65,7 +67,10 @@ private:
   void startSubscription();
   void contextCallback(const openscenario_interpreter_msgs::msg::Context::ConstSharedPtr msg);
   void spin();
-  std::string context_;
+  void indexContext(const nlohmann::json & node, const nlohmann::json::json_pointer & pointer);
+  void updateConditionGroups();
+  nlohmann::json context_;
+  std::unordered_map<std::string, nlohmann::json::json_pointer> context_pointers_;
   double simulation_time_;
   std::vector<std::string> item_vec_;
   std::vector<std::vector<std::string>> condition_group_vec_;
@@ -65,6 +65,8 @@ extern "C" {
 }  // extern "C"
 #endif
 
+#include <cstddef>
+#include <cstdint>
 #include <rclcpp/rclcpp.hpp>
 #include <string>
 #include <traffic_simulator/color_utils/color_utils.hpp>
@@ -124,9 +126,31 @@ private:
   rclcpp::Subscription<traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray>::SharedPtr
     entity_status_sub_;
   /**
-   * @brief buffers for generated markers.
+   * @brief whether the NPCs have their TF frames, as the ego always does.
    */
-  std::unordered_map<std::string, visualization_msgs::msg::MarkerArray> markers_;
+  const bool broadcast_npc_tf_;
+  /**
+   * @brief the markers last published for each entity, by their ids.
+   */
+  std::unordered_map<std::string, std::unordered_map<std::int32_t, visualization_msgs::msg::Marker>>
+    markers_;
+  /**
+   * @brief the number of subscribers of the marker topic, to find new ones.
+   */
+  std::size_t marker_subscription_count_ = 0;
+  /**
+   * @brief timer to request sending all the markers again, in case a subscriber missed some.
+   */
+  rclcpp::TimerBase::SharedPtr republish_timer_;
+  /**
+   * @brief whether the next entity status array sends all the markers instead of the changed ones.
+   */
+  bool republish_requested_ = false;
+  /**
+   * @brief the latest waypoint and goal_pose of each entity, which are sent only when changed.
+   */
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatusWithTrajectory>
+    trajectories_;
 };
 }  // namespace openscenario_visualization
 
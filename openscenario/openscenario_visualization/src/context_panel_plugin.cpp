@@ -54,12 +54,48 @@ void ContextPanel::onDisable()
 void ContextPanel::contextCallback(
   const openscenario_interpreter_msgs::msg::Context::ConstSharedPtr msg)
 {
-  context_ = msg->data;
+  if (msg->type == openscenario_interpreter_msgs::msg::Context::SNAPSHOT) {
+    context_ = json::parse(msg->data);
+    context_pointers_.clear();
+    indexContext(context_, json::json_pointer());
+  } else if (context_.is_null()) {
+    return;  // A delta is meaningless until the first snapshot has been received.
+  } else {
+    const auto delta = json::parse(msg->data);
+    for (auto it = delta.begin(); it != delta.end(); ++it) {
+      const auto pointer = context_pointers_.find(it.key());
+      if (pointer != context_pointers_.end()) {
+        context_[pointer->second].update(it.value());
+      }
+    }
+  }
   simulation_time_ = msg->time;
-  json j_ = json::parse(context_);
+  updateConditionGroups();
+  display_trigger();
+}
+
+void ContextPanel::indexContext(const json & node, const json::json_pointer & pointer)
+{
+  if (node.is_object()) {
+    const auto id = node.find("id");
+    if (id != node.end()) {
+      context_pointers_[id->get<std::string>()] = pointer;
+    }
+    for (auto it = node.begin(); it != node.end(); ++it) {
+      indexContext(it.value(), pointer / it.key());
+    }
+  } else if (node.is_array()) {
+    for (std::size_t i = 0; i < node.size(); ++i) {
+      indexContext(node[i], pointer / i);
+    }
+  }
+}
+
+void ContextPanel::updateConditionGroups()
+{
   condition_group_vec_.clear();
   item_vec_.clear();
-  auto story_json = j_["OpenSCENARIO"]["Storyboard"]["Story"];
+  auto story_json = context_["OpenSCENARIO"]["Storyboard"]["Story"];
   for (json::iterator it1 = story_json.begin(); it1 != story_json.end(); ++it1) {
     for (json::iterator it2 = (*it1)["Act"].begin(); it2 != (*it1)["Act"].end(); ++it2) {
       for (json::iterator it3 = (*it2)["ManeuverGroup"].begin();
@@ -91,7 +127,6 @@ void ContextPanel::contextCallback(
   condition_group_vec_.erase(
     std::unique(condition_group_vec_.begin(), condition_group_vec_.end()),
     condition_group_vec_.end());
-  display_trigger();
 }
 
 void ContextPanel::updateTopicCandidates()
@@ -190,7 +225,7 @@ void ContextPanel::startSubscription()
 {
   std::string topic = ui_->TopicSelect->currentText().toStdString();
   context_sub_ = node_->create_subscription<openscenario_interpreter_msgs::msg::Context>(
-    topic, 1, std::bind(&ContextPanel::contextCallback, this, std::placeholders::_1));
+    topic, 10, std::bind(&ContextPanel::contextCallback, this, std::placeholders::_1));
 }
 
 void ContextPanel::selectTopic(int)
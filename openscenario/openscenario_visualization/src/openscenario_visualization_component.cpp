@@ -45,59 +45,114 @@
 #include <quaternion_operation/quaternion_operation.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <color_names/color_names.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
+#include <geometry/transform.hpp>
 #include <openscenario_visualization/openscenario_visualization_component.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace openscenario_visualization
 {
 OpenscenarioVisualizationComponent::OpenscenarioVisualizationComponent(
   const rclcpp::NodeOptions & options)
-: Node("openscenario_visualization", options)
+: Node("openscenario_visualization", options),
+  broadcast_npc_tf_(declare_parameter<bool>("broadcast_npc_tf", true))
 {
-  marker_pub_ = create_publisher<visualization_msgs::msg::MarkerArray>("entity/marker", 1);
+  marker_pub_ = create_publisher<visualization_msgs::msg::MarkerArray>(
+    "entity/marker", rclcpp::QoS(100));
   entity_status_sub_ =
     this->create_subscription<traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray>(
-      "entity/status", 1,
+      "entity/status", rclcpp::QoS(100),
       std::bind(
         &OpenscenarioVisualizationComponent::entityStatusCallback, this, std::placeholders::_1));
+  republish_timer_ =
+    create_wall_timer(std::chrono::seconds(1), [this]() { republish_requested_ = true; });
 }
 
 void OpenscenarioVisualizationComponent::entityStatusCallback(
   const traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray::ConstSharedPtr msg)
 {
+  /*
+     Markers are sent only when they differ from the ones last sent, and never
+     expire, so that the bandwidth to RViz is proportional to what changed
+     rather than to the number of entities. Most markers are locked to the
+     frame of their entity, so a moving entity moves them by TF alone, except
+     for NPCs without TF (see generateMarker).
+  */
+  const auto subscription_count = marker_pub_->get_subscription_count();
+
+  /*
+     A new subscriber has not seen any marker yet. All the markers are also
+     sent again periodically, for a subscriber that missed a message or that
+     replaced another one without changing the count.
+  */
+  const auto republish =
+    std::exchange(republish_requested_, false) or marker_subscription_count_ < subscription_count;
+
+  marker_subscription_count_ = subscription_count;
+
   visualization_msgs::msg::MarkerArray current_marker;
-  std::vector<std::string> entity_name_lists;
+  std::unordered_set<std::string> entity_names;
   for (const auto & data : msg->data) {
-    entity_name_lists.emplace_back(data.status.name);
+    entity_names.emplace(data.name);
   }
-  std::vector<std::string> erase_names;
-  for (const auto & marker : markers_) {
-    auto itr = std::find(entity_name_lists.begin(), entity_name_lists.end(), marker.first);
-    if (itr == entity_name_lists.end()) {
-      auto delete_marker = generateDeleteMarker(marker.first);
-      std::copy(
+  for (auto iter = markers_.begin(); iter != markers_.end();) {
+    if (entity_names.count(iter->first)) {
+      ++iter;
+    } else {
+      auto delete_marker = generateDeleteMarker(iter->first);
+      std::move(
         delete_marker.markers.begin(), delete_marker.markers.end(),
         std::back_inserter(current_marker.markers));
-      erase_names.emplace_back(marker.first);
+      trajectories_.erase(iter->first);
+      iter = markers_.erase(iter);
     }
   }
-  for (const auto & name : erase_names) {
-    markers_.erase(markers_.find(name));
-  }
+  const auto stamp = get_clock()->now();
   for (const auto & data : msg->data) {
-    auto marker_array =
-      generateMarker(data.status, data.goal_pose, data.waypoint, data.obstacle, data.obstacle_find);
-    std::copy(
-      marker_array.markers.begin(), marker_array.markers.end(),
-      std::back_inserter(current_marker.markers));
-    markers_[data.name] = marker_array;
+    if (data.trajectory_updated) {
+      trajectories_[data.name] = data;
+    }
+    const auto & trajectory = trajectories_[data.name];
+    auto marker_array = generateMarker(
+      data.status, trajectory.goal_pose, trajectory.waypoint, data.obstacle, data.obstacle_find);
+    auto & markers = markers_[data.name];
+    std::unordered_set<std::int32_t> ids;
+    for (auto & marker : marker_array.markers) {
+      ids.emplace(marker.id);
+      auto & previous = markers[marker.id];
+      marker.header.stamp = previous.header.stamp;
+      if (republish or marker != previous) {
+        marker.header.stamp = stamp;
+        previous = marker;
+        current_marker.markers.push_back(std::move(marker));
+      }
+    }
+    // NOTE: e.g. the arrows (ids from 10) and texts (ids from 100) of the goals reached.
+    for (auto iter = markers.begin(); iter != markers.end();) {
+      if (ids.count(iter->first)) {
+        ++iter;
+      } else {
+        visualization_msgs::msg::Marker delete_marker;
+        delete_marker.action = delete_marker.DELETE;
+        delete_marker.header.frame_id = iter->second.header.frame_id;
+        delete_marker.header.stamp = stamp;
+        delete_marker.ns = iter->second.ns;
+        delete_marker.id = iter->second.id;
+        current_marker.markers.push_back(std::move(delete_marker));
+        iter = markers.erase(iter);
+      }
+    }
+  }
+  if (not current_marker.markers.empty()) {
+    marker_pub_->publish(current_marker);
   }
-  marker_pub_->publish(current_marker);
 }
 
 const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::generateDeleteMarker(
@@ -105,10 +160,11 @@ const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::g
 {
   auto ret = visualization_msgs::msg::MarkerArray();
   auto stamp = get_clock()->now();
-  for (const auto & marker : markers_[ns].markers) {
+  for (const auto & id_and_marker : markers_[ns]) {
+    const auto & marker = id_and_marker.second;
     visualization_msgs::msg::Marker marker_msg;
     marker_msg.action = marker_msg.DELETE;
-    marker_msg.header.frame_id = ns;
+    marker_msg.header.frame_id = marker.header.frame_id;
     marker_msg.header.stamp = stamp;
     marker_msg.ns = marker.ns;
     marker_msg.id = marker.id;
@@ -139,81 +195,74 @@ const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::g
       break;
   }
 
-  if (goal_pose.size() != 0) {
-    goal_pose_max_size = std::max(goal_pose_max_size, int(goal_pose.size()));
-    for (std::vector<geometry_msgs::msg::Pose>::size_type i = 0; i < unsigned(goal_pose_max_size);
-         i++) {
-      if (i < goal_pose.size()) {
-        visualization_msgs::msg::Marker goal_pose_marker;
-        goal_pose_marker.header.frame_id = "map";
-        goal_pose_marker.header.stamp = stamp;
-        goal_pose_marker.ns = status.name;
-        goal_pose_marker.id = 10 + int(goal_pose_max_size - goal_pose.size() + i);
-        goal_pose_marker.action = goal_pose_marker.ADD;
-        goal_pose_marker.type = 0;  //arrow
-        goal_pose_marker.pose = goal_pose[i];
-        goal_pose_marker.color = color;
-        goal_pose_marker.scale.x = 1.6;
-        goal_pose_marker.scale.y = 0.2;
-        goal_pose_marker.scale.z = 0.2;
-        goal_pose_marker.lifetime = rclcpp::Duration::from_seconds(0.1);
-        ret.markers.emplace_back(goal_pose_marker);
-
-        visualization_msgs::msg::Marker goal_pose_text_marker;
-        goal_pose_text_marker.type = goal_pose_text_marker.TEXT_VIEW_FACING;
-        goal_pose_text_marker.header.frame_id = "map";
-        goal_pose_text_marker.header.stamp = stamp;
-        goal_pose_text_marker.ns = status.name;
-        goal_pose_text_marker.id = 100 + int(goal_pose_max_size - goal_pose.size() + i);
-        goal_pose_text_marker.action = goal_pose_text_marker.ADD;
-        goal_pose_text_marker.pose.position.x = goal_pose[i].position.x;
-        goal_pose_text_marker.pose.position.y = goal_pose[i].position.y;
-        goal_pose_text_marker.pose.position.z = goal_pose[i].position.z + 1.0;
-        goal_pose_text_marker.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
-        goal_pose_text_marker.type = goal_pose_text_marker.TEXT_VIEW_FACING;
-        goal_pose_text_marker.scale.x = 0.0;
-        goal_pose_text_marker.scale.y = 0.0;
-        goal_pose_text_marker.scale.z = 0.6;
-        goal_pose_text_marker.lifetime = rclcpp::Duration::from_seconds(0.1);
-        goal_pose_text_marker.text =
-          status.name + "_goal_" + std::to_string(int(goal_pose_max_size - goal_pose.size() + i));
-        goal_pose_text_marker.color = color_names::makeColorMsg("white", 0.99);
-        ret.markers.emplace_back(goal_pose_text_marker);
-      } else {
-        visualization_msgs::msg::Marker goal_pose_marker;
-        goal_pose_marker.action = goal_pose_marker.DELETE;
-        goal_pose_marker.id = 10 + int(i - (goal_pose_max_size - goal_pose.size()));
-        goal_pose_marker.ns = status.name;
-        ret.markers.emplace_back(goal_pose_marker);
-        visualization_msgs::msg::Marker goal_pose_text_marker;
-        goal_pose_text_marker.action = goal_pose_text_marker.DELETE;
-        goal_pose_text_marker.id = 100 + int(i - (goal_pose_max_size - goal_pose.size()));
-        goal_pose_text_marker.ns = status.name;
-        ret.markers.emplace_back(goal_pose_text_marker);
-      }
-    }
-  } else {
+  /*
+     Goals are numbered backwards from the longest list of goals seen, so the
+     ids of the remaining ones do not change as the goals are reached. The
+     markers of the reached goals are not generated anymore, and are deleted
+     by entityStatusCallback.
+  */
+  goal_pose_max_size = std::max(goal_pose_max_size, int(goal_pose.size()));
+  for (std::vector<geometry_msgs::msg::Pose>::size_type i = 0; i < goal_pose.size(); i++) {
     visualization_msgs::msg::Marker goal_pose_marker;
-    goal_pose_marker.action = goal_pose_marker.DELETE;
-    goal_pose_marker.id = 10 + int(goal_pose_max_size - 1);
+    goal_pose_marker.header.frame_id = "map";
+    goal_pose_marker.header.stamp = stamp;
     goal_pose_marker.ns = status.name;
+    goal_pose_marker.id = 10 + int(goal_pose_max_size - goal_pose.size() + i);
+    goal_pose_marker.action = goal_pose_marker.ADD;
+    goal_pose_marker.type = 0;  //arrow
+    goal_pose_marker.pose = goal_pose[i];
+    goal_pose_marker.color = color;
+    goal_pose_marker.scale.x = 1.6;
+    goal_pose_marker.scale.y = 0.2;
+    goal_pose_marker.scale.z = 0.2;
     ret.markers.emplace_back(goal_pose_marker);
+
     visualization_msgs::msg::Marker goal_pose_text_marker;
-    goal_pose_text_marker.action = goal_pose_text_marker.DELETE;
-    goal_pose_text_marker.id = 100 + int(goal_pose_max_size - 1);
+    goal_pose_text_marker.type = goal_pose_text_marker.TEXT_VIEW_FACING;
+    goal_pose_text_marker.header.frame_id = "map";
+    goal_pose_text_marker.header.stamp = stamp;
     goal_pose_text_marker.ns = status.name;
+    goal_pose_text_marker.id = 100 + int(goal_pose_max_size - goal_pose.size() + i);
+    goal_pose_text_marker.action = goal_pose_text_marker.ADD;
+    goal_pose_text_marker.pose.position.x = goal_pose[i].position.x;
+    goal_pose_text_marker.pose.position.y = goal_pose[i].position.y;
+    goal_pose_text_marker.pose.position.z = goal_pose[i].position.z + 1.0;
+    goal_pose_text_marker.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
+    goal_pose_text_marker.type = goal_pose_text_marker.TEXT_VIEW_FACING;
+    goal_pose_text_marker.scale.x = 0.0;
+    goal_pose_text_marker.scale.y = 0.0;
+    goal_pose_text_marker.scale.z = 0.6;
+    goal_pose_text_marker.text =
+      status.name + "_goal_" + std::to_string(int(goal_pose_max_size - goal_pose.size() + i));
+    goal_pose_text_marker.color = color_names::makeColorMsg("white", 0.99);
     ret.markers.emplace_back(goal_pose_text_marker);
   }
 
+  /*
+     The markers of the entity itself are locked to its TF frame, so that RViz
+     moves them along with the entity without receiving them again. NPCs have
+     no TF frame when broadcast_npc_tf is false, so their markers are drawn at
+     their current pose in the map frame instead, and are sent again whenever
+     they move.
+  */
+  const bool frame_locked = broadcast_npc_tf_ or status.type.type == status.type.EGO;
+  const auto frame_id = frame_locked ? status.name : std::string("map");
+  auto entity_pose = geometry_msgs::msg::Pose();
+  if (frame_locked) {
+    entity_pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
+  } else {
+    entity_pose = status.pose;
+  }
+
   visualization_msgs::msg::Marker bbox;
-  bbox.header.frame_id = status.name;
+  bbox.header.frame_id = frame_id;
   bbox.header.stamp = stamp;
+  bbox.frame_locked = frame_locked;
   bbox.ns = status.name;
   bbox.id = 0;
   bbox.action = bbox.ADD;
-  bbox.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
+  bbox.pose = entity_pose;
   bbox.type = bbox.LINE_LIST;
-  bbox.lifetime = rclcpp::Duration::from_seconds(0.1);
   geometry_msgs::msg::Point p0, p1, p2, p3, p4, p5, p6, p7;
 
   p0.x = status.bounding_box.center.x + status.bounding_box.dimensions.x * 0.5;
@@ -303,8 +352,9 @@ const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::g
   ret.markers.emplace_back(bbox);
 
   visualization_msgs::msg::Marker text;
-  text.header.frame_id = status.name;
+  text.header.frame_id = frame_id;
   text.header.stamp = stamp;
+  text.frame_locked = frame_locked;
   text.ns = status.name;
   text.id = 1;
   text.action = text.ADD;
@@ -312,19 +362,20 @@ const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::g
   text.pose.position.y = status.bounding_box.center.y;
   text.pose.position.z =
     status.bounding_box.center.z + status.bounding_box.dimensions.z * 0.5 + 1.0;
+  text.pose.position = math::geometry::transformPoint(entity_pose, text.pose.position);
   text.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
   text.type = text.TEXT_VIEW_FACING;
   text.scale.x = 0.0;
   text.scale.y = 0.0;
   text.scale.z = 0.6;
-  text.lifetime = rclcpp::Duration::from_seconds(0.1);
   text.text = status.name;
   text.color = color_names::makeColorMsg("white", 0.99);
   ret.markers.emplace_back(text);
 
   visualization_msgs::msg::Marker arrow;
-  arrow.header.frame_id = status.name;
+  arrow.header.frame_id = frame_id;
   arrow.header.stamp = stamp;
+  arrow.frame_locked = frame_locked;
   arrow.ns = status.name;
   arrow.id = 2;
   arrow.action = arrow.ADD;
@@ -348,28 +399,28 @@ const visualization_msgs::msg::MarkerArray OpenscenarioVisualizationComponent::g
   pr.z = status.bounding_box.center.z - status.bounding_box.dimensions.z * 0.5;
   arrow.points = {pf, pl, pr};
   arrow.colors = {color};
-  arrow.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
+  arrow.pose = entity_pose;
   arrow.type = arrow.TRIANGLE_LIST;
   arrow.scale.x = 1.0;
   arrow.scale.y = 1.0;
   arrow.scale.z = 1.0;
-  arrow.lifetime = rclcpp::Duration::from_seconds(0.1);
   arrow.color = color_names::makeColorMsg("red", 0.99);
   ret.markers.emplace_back(arrow);
 
   visualization_msgs::msg::Marker text_action;
-  text_action.header.frame_id = status.name;
+  text_action.header.frame_id = frame_id;
   text_action.header.stamp = stamp;
+  text_action.frame_locked = frame_locked;
   text_action.ns = status.name;
   text_action.id = 3;
   text_action.action = text_action.ADD;
-  text_action.pose.position = status.bounding_box.center;
+  text_action.pose.position =
+    math::geometry::transformPoint(entity_pose, status.bounding_box.center);
   text_action.pose.orientation = geometry_msgs::msg::Quaternion(default_quaternion);
   text_action.type = text_action.TEXT_VIEW_FACING;
   text_action.scale.x = 0.0;
   text_action.scale.y = 0.0;
   text_action.scale.z = 0.4;
-  text_action.lifetime = rclcpp::Duration::from_seconds(0.1);
   text_action.text = status.action_status.current_action;
   if (status.lanelet_pose_valid) {
     text_action.text = text_action.text + "\nid:" + std::to_string(status.lanelet_pose.lanelet_id) +
@@ -0,0 +1,49 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <simple_sensor_simulator/sensor_simulation/occupancy_grid/grid.hpp>
+#include <vector>
+
+#include "boxes.hpp"
+
+/*
+   One iteration is one frame of OccupancySensor: resetting a 0.5 m
+   resolution, 200 x 200 cells grid and drawing the bounding boxes of the
+   given number of entities on it.
+*/
+static void AddPrimitive(benchmark::State & state)
+{
+  simple_sensor_simulator::Grid grid(0.5, 200, 200);
+  std::vector<std::unique_ptr<simple_sensor_simulator::primitives::Primitive>> primitives;
+  for (const auto & pose : makeBoxPoses(state.range(0))) {
+    primitives.push_back(
+      std::make_unique<simple_sensor_simulator::primitives::Box>(4.5, 2.1, 1.8, pose));
+  }
+  const auto origin = geometry_msgs::msg::Pose();
+  for (auto _ : state) {
+    grid.reset(origin);
+    for (const auto & primitive : primitives) {
+      grid.addPrimitive(primitive);
+    }
+    benchmark::DoNotOptimize(grid.getData().data());
+  }
+  state.SetItemsProcessed(state.iterations() * primitives.size());
+}
+
+BENCHMARK(AddPrimitive)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
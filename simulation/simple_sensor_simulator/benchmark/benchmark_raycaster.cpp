@@ -0,0 +1,65 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
+#include <string>
+#include <vector>
+
+#include "boxes.hpp"
+
+namespace
+{
+/*
+   The vertical angles of VLP-16, the same as the ones given by
+   traffic_simulator::helper::constructLidarConfiguration.
+*/
+auto verticalAngles()
+{
+  std::vector<double> vertical_angles;
+  for (auto degree = -15; degree <= 15; degree += 2) {
+    vertical_angles.push_back(degree / 180.0 * M_PI);
+  }
+  return vertical_angles;
+}
+}  // namespace
+
+/*
+   One iteration is one frame of LidarSensor: adding the bounding boxes of
+   the given number of entities and casting rays (VLP-16, 1 degree horizontal
+   resolution, 16 x 360 rays) against them.
+*/
+static void Raycast(benchmark::State & state)
+{
+  simple_sensor_simulator::Raycaster raycaster;
+  const auto boxes = makeBoxPoses(state.range(0));
+  const auto vertical_angles = verticalAngles();
+  const auto stamp = rclcpp::Time(0);
+  geometry_msgs::msg::Pose origin;
+  origin.position.z = 2.0;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+        "box" + std::to_string(i), 4.5, 2.1, 1.8, boxes[i]);
+    }
+    benchmark::DoNotOptimize(
+      raycaster.raycast("base_link", stamp, origin, 1.0 / 180.0 * M_PI, vertical_angles));
+  }
+}
+
+BENCHMARK(Raycast)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
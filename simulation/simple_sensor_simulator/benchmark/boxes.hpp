@@ -0,0 +1,48 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_SENSOR_SIMULATOR__BENCHMARK__BOXES_HPP_
+#define SIMPLE_SENSOR_SIMULATOR__BENCHMARK__BOXES_HPP_
+
+#include <quaternion_operation/quaternion_operation.h>
+
+#include <cmath>
+#include <cstddef>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/vector3.hpp>
+#include <vector>
+
+/*
+   Poses of vehicle sized boxes scattered deterministically on rings 10 m to
+   42 m around the origin, so that every sensor sees (most of) them.
+*/
+inline auto makeBoxPoses(std::size_t size)
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto angle = 2.399963 * i;  // NOTE: The golden angle, not to line the boxes up.
+    const auto radius = 10.0 + 8.0 * (i % 5);
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = radius * std::cos(angle);
+    pose.position.y = radius * std::sin(angle);
+    pose.position.z = 0.9;
+    geometry_msgs::msg::Vector3 rpy;
+    rpy.z = angle;
+    pose.orientation = quaternion_operation::convertEulerAngleToQuaternion(rpy);
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+#endif  // SIMPLE_SENSOR_SIMULATOR__BENCHMARK__BOXES_HPP_
@@ -18,8 +18,12 @@
 #include <simulation_api_schema.pb.h>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
+#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
 #include <vector>
 
@@ -32,25 +36,37 @@ protected:
 
   simulation_api_schema::DetectionSensorConfiguration configuration_;
 
+  // NOTE: Only for filter_by_occlusion, since an embree device and scene are not free to create.
+  boost::optional<Raycaster> raycaster_;
+
   explicit DetectionSensorBase(
     const double last_update_stamp,
     const simulation_api_schema::DetectionSensorConfiguration & configuration)
   : last_update_stamp_(last_update_stamp), configuration_(configuration)
   {
+    if (configuration_.filter_by_occlusion()) {
+      raycaster_.emplace();
+    }
   }
 
-  const std::vector<std::string> getDetectedObjects(
-    const std::vector<traffic_simulator_msgs::EntityStatus> & status) const;
+  auto getDetectedObjects(const EntityTable & table) const -> EntityTable::Selection;
+
+  auto getSensorIndex(const EntityTable & table) const -> std::size_t;
 
-  geometry_msgs::Pose getSensorPose(
-    const std::vector<traffic_simulator_msgs::EntityStatus> & status) const;
+  /**
+   * @brief the ratio of each entity in range visible from the sensor, or zero for the others
+   * @note Only entities in range are added to the scene as occluders, since an entity out of
+   * range hardly stands between the sensor and an entity in range.
+   * @pre filter_by_occlusion is set, so that raycaster_ exists.
+   */
+  auto getVisibleRatios(const EntityTable & table) -> std::vector<double>;
 
 public:
   virtual ~DetectionSensorBase() = default;
 
   virtual void update(
-    const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
-    const std::vector<std::string> & lidar_detected_entity) = 0;
+    const double, const EntityTable &, const rclcpp::Time &,
+    const EntityTable::Selection & lidar_detected_entity) = 0;
 };
 
 template <typename T>
@@ -68,14 +84,14 @@ public:
   }
 
   auto update(
-    const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
-    const std::vector<std::string> & lidar_detected_entity) -> void override;
+    const double, const EntityTable &, const rclcpp::Time &,
+    const EntityTable::Selection & lidar_detected_entity) -> void override;
 };
 
 template <>
 void DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::update(
-  const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
-  const std::vector<std::string> & lidar_detected_entity);
+  const double, const EntityTable &, const rclcpp::Time &,
+  const EntityTable::Selection & lidar_detected_entity);
 }  // namespace simple_sensor_simulator
 
 #endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__DETECTION_SENSOR__DETECTION_SENSOR_HPP_
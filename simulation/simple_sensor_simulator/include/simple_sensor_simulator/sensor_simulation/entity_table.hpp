@@ -0,0 +1,98 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__ENTITY_TABLE_HPP_
+#define SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__ENTITY_TABLE_HPP_
+
+#include <simulation_api_schema.pb.h>
+
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <geometry_msgs/msg/pose.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace simple_sensor_simulator
+{
+/* ---- EntityTable ------------------------------------------------------------
+ *
+ *  The entity statuses of a frame indexed by their names. SensorSimulation
+ *  builds it once per frame and all sensors share it, so that each sensor
+ *  neither searches the statuses for its ego nor computes the pose of the
+ *  bounding boxes again.
+ *
+ *  A selection of entities is a vector of flags in the same order as the
+ *  statuses, so that a sensor tells whether an entity is selected without
+ *  comparing names.
+ *
+ * -------------------------------------------------------------------------- */
+class EntityTable
+{
+  const std::vector<traffic_simulator_msgs::EntityStatus> & statuses_;
+
+  std::unordered_map<std::string, std::size_t> indices_;
+
+  std::vector<std::string> duplicate_names_;
+
+  std::vector<geometry_msgs::msg::Pose> bounding_box_poses_;
+
+  mutable std::unordered_map<std::size_t, std::vector<double>> distances_;
+
+public:
+  using Selection = std::vector<bool>;
+
+  /**
+   * @note The table refers to `statuses` rather than copying them, so they must outlive the table
+   * and must not be modified while it is in use.
+   */
+  explicit EntityTable(const std::vector<traffic_simulator_msgs::EntityStatus> & statuses);
+
+  auto size() const noexcept { return statuses_.size(); }
+
+  auto status(std::size_t index) const -> const auto & { return statuses_[index]; }
+
+  /**
+   * @brief the pose of the center of the bounding box of the entity in the map frame
+   */
+  auto boundingBoxPose(std::size_t index) const -> const auto &
+  {
+    return bounding_box_poses_[index];
+  }
+
+  /**
+   * @brief the names given to more than one status, of which only the first is found by name
+   * @note Whether they are an error is up to each sensor.
+   */
+  auto duplicateNames() const -> const auto & { return duplicate_names_; }
+
+  auto find(const std::string & name) const -> boost::optional<std::size_t>;
+
+  /**
+   * @brief the index of the entity of the given name only if it is the ego
+   */
+  auto findEgo(const std::string & name) const -> boost::optional<std::size_t>;
+
+  auto select(const std::vector<std::string> & names) const -> Selection;
+
+  /**
+   * @brief select entities within the range of the given one, except itself
+   * @note The distances from an entity are computed once per frame, however
+   * many sensors select entities around it.
+   */
+  auto selectInRange(std::size_t index, double range) const -> Selection;
+};
+}  // namespace simple_sensor_simulator
+
+#endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__ENTITY_TABLE_HPP_
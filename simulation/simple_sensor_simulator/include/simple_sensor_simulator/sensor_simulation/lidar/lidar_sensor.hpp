@@ -20,6 +20,7 @@
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
 #include <vector>
@@ -44,9 +45,7 @@ protected:
 public:
   virtual ~LidarSensorBase() = default;
 
-  virtual auto update(
-    const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-    -> void = 0;
+  virtual auto update(const double, const EntityTable &, const rclcpp::Time &) -> void = 0;
 
   auto getDetectedObjects() const -> const std::vector<std::string> & { return detected_objects_; }
 };
@@ -56,8 +55,7 @@ class LidarSensor : public LidarSensorBase
 {
   const typename rclcpp::Publisher<T>::SharedPtr publisher_ptr_;
 
-  auto raycast(const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-    -> T;
+  auto raycast(const EntityTable &, const rclcpp::Time &) -> T;
 
 public:
   explicit LidarSensor(
@@ -67,13 +65,12 @@ public:
   {
   }
 
-  auto update(
-    const double current_time, const std::vector<traffic_simulator_msgs::EntityStatus> & status,
-    const rclcpp::Time & stamp) -> void override
+  auto update(const double current_time, const EntityTable & table, const rclcpp::Time & stamp)
+    -> void override
   {
     if (current_time - last_update_stamp_ - configuration_.scan_duration() >= -0.002) {
       last_update_stamp_ = current_time;
-      publisher_ptr_->publish(raycast(status, stamp));
+      publisher_ptr_->publish(raycast(table, stamp));
     } else {
       detected_objects_ = {};
     }
@@ -82,8 +79,7 @@ public:
 
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
-  const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-  -> sensor_msgs::msg::PointCloud2;
+  const EntityTable &, const rclcpp::Time &) -> sensor_msgs::msg::PointCloud2;
 }  // namespace simple_sensor_simulator
 
 #endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__LIDAR__LIDAR_SENSOR_HPP_
@@ -54,6 +54,16 @@ public:
     double horizontal_angle_start = 0, double horizontal_angle_end = 2 * M_PI,
     double max_distance = 100, double min_distance = 0);
   const std::vector<std::string> & getDetectedObject() const;
+  /**
+   * @brief the ratio of the rays from the origin to sample points of each target that reach the
+   * target without hitting any other primitive
+   * @note A target which looks smaller than about a degree is sampled only at its center, and the
+   * others at their center and corners, so that the number of rays is proportional to the number
+   * of targets rather than to the resolution of a lidar sweep. As with raycast, all the primitives
+   * added so far are removed after the call.
+   */
+  std::vector<double> getVisibleRatios(
+    const geometry_msgs::msg::Point & origin, const std::vector<std::string> & targets);
 
 private:
   std::vector<geometry_msgs::msg::Quaternion> getDirections(
@@ -17,9 +17,11 @@
 
 #include <simulation_api_schema.pb.h>
 
+#include <cstddef>
 #include <memory>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
 #include <string>
 #include <vector>
 
@@ -53,24 +55,22 @@ public:
    * @brief Update sensor status
    */
   virtual void update(
-    const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
-    const std::vector<std::string> & lidar_detected_entity) = 0;
+    const double, const EntityTable &, const rclcpp::Time &,
+    const EntityTable::Selection & lidar_detected_entity) = 0;
 
   /**
-   * @brief List all objects in range of sensor sight
-   * @return names of objects in range of sensor sight
+   * @brief Select all objects in range of sensor sight
+   * @return selection of objects in range of sensor sight
    */
-  const std::vector<std::string> getDetectedObjects(
-    const std::vector<traffic_simulator_msgs::EntityStatus> & status) const;
+  auto getDetectedObjects(const EntityTable & table) const -> EntityTable::Selection;
 
   /**
-   * @brief Extract sensor pose from entity statuses
-   * @return sensor pose
-   * @warning `status` must contain EGO object
-   * @exception SimulationRuntimeError if `status` does not contain EGO object
+   * @brief Find the entity the sensor is attached to
+   * @return index of the sensor entity in `table`
+   * @warning `table` must contain EGO object
+   * @exception SimulationRuntimeError if `table` does not contain EGO object
    */
-  geometry_msgs::Pose getSensorPose(
-    const std::vector<traffic_simulator_msgs::EntityStatus> & status) const;
+  auto getSensorIndex(const EntityTable & table) const -> std::size_t;
 };
 
 /**
@@ -85,9 +85,8 @@ class OccupancyGridSensor : public OccupancyGridSensorBase
    * @brief construct occupancy grid from entity list
    * @return occupancy grid of specified type
    */
-  auto getOccupancyGrid(
-    const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
-    const std::vector<std::string> &) -> T;
+  auto getOccupancyGrid(const EntityTable &, const rclcpp::Time &, const EntityTable::Selection &)
+    -> T;
 
 public:
   explicit OccupancyGridSensor(
@@ -101,13 +100,12 @@ public:
   }
 
   auto update(
-    const double current_time, const std::vector<traffic_simulator_msgs::EntityStatus> & status,
-    const rclcpp::Time & stamp, const std::vector<std::string> & lidar_detected_entity)
-    -> void override
+    const double current_time, const EntityTable & table, const rclcpp::Time & stamp,
+    const EntityTable::Selection & lidar_detected_entity) -> void override
   {
     if (current_time - last_update_stamp_ - configuration_.update_duration() >= -0.002) {
       last_update_stamp_ = current_time;
-      publisher_ptr_->publish(getOccupancyGrid(status, stamp, lidar_detected_entity));
+      publisher_ptr_->publish(getOccupancyGrid(table, stamp, lidar_detected_entity));
     } else {
       detected_objects_ = {};
     }
@@ -119,8 +117,8 @@ private:
 
 template <>
 auto OccupancyGridSensor<nav_msgs::msg::OccupancyGrid>::getOccupancyGrid(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status, const rclcpp::Time & stamp,
-  const std::vector<std::string> & lidar_detected_entity) -> nav_msgs::msg::OccupancyGrid;
+  const EntityTable & table, const rclcpp::Time & stamp,
+  const EntityTable::Selection & lidar_detected_entity) -> nav_msgs::msg::OccupancyGrid;
 }  // namespace simple_sensor_simulator
 
 #endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__OCCUPANCY_GRID__OCCUPANCY_GRID_SENSOR_HPP_
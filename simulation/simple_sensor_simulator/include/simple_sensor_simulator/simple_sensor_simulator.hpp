@@ -18,6 +18,7 @@
 #include <tf2/LinearMath/Quaternion.h>
 #include <tf2_ros/transform_broadcaster.h>
 
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/transform_stamped.hpp>
 #include <map>
@@ -133,6 +134,9 @@ private:
   bool initialized_;
   std::vector<traffic_simulator_msgs::EntityStatus> entity_status_;
   zeromq::MultiServer server_;
+  const rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr
+    profiler_diagnostics_pub_;
+  rclcpp::TimerBase::SharedPtr profiler_diagnostics_timer_;
 };
 }  // namespace simple_sensor_simulator
 
@@ -12,9 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <quaternion_operation/quaternion_operation.h>
-
-#include <algorithm>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -27,39 +24,52 @@
 
 namespace simple_sensor_simulator
 {
-const std::vector<std::string> DetectionSensorBase::getDetectedObjects(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status) const
+auto DetectionSensorBase::getDetectedObjects(const EntityTable & table) const
+  -> EntityTable::Selection
 {
-  std::vector<std::string> detected_objects;
-  const auto pose = getSensorPose(status);
-  for (const auto & s : status) {
-    double distance = std::hypot(
-      s.pose().position().x() - pose.position().x(), s.pose().position().y() - pose.position().y(),
-      s.pose().position().z() - pose.position().z());
-    if (s.name() != configuration_.entity() && distance <= configuration_.range()) {
-      detected_objects.emplace_back(s.name());
-    }
+  return table.selectInRange(getSensorIndex(table), configuration_.range());
+}
+
+auto DetectionSensorBase::getSensorIndex(const EntityTable & table) const -> std::size_t
+{
+  if (const auto index = table.findEgo(configuration_.entity())) {
+    return *index;
   }
-  return detected_objects;
+  throw SimulationRuntimeError("Detection sensor can be attached only ego entity.");
 }
 
-geometry_msgs::Pose DetectionSensorBase::getSensorPose(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status) const
+auto DetectionSensorBase::getVisibleRatios(const EntityTable & table) -> std::vector<double>
 {
-  for (const auto & s : status) {
-    if (
-      s.type().type() == traffic_simulator_msgs::EntityType::EGO &&
-      s.name() == configuration_.entity()) {
-      return s.pose();
+  const auto sensor_index = getSensorIndex(table);
+
+  const auto in_range = table.selectInRange(sensor_index, configuration_.range());
+
+  std::vector<std::size_t> indices;
+  std::vector<std::string> targets;
+  for (std::size_t index = 0; index < table.size(); ++index) {
+    if (const auto & s = table.status(index); in_range[index]) {
+      raycaster_->addPrimitive<primitives::Box>(
+        s.name(), s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
+        s.bounding_box().dimensions().z(), table.boundingBoxPose(index));
+      indices.push_back(index);
+      targets.push_back(s.name());
     }
   }
-  throw SimulationRuntimeError("Detection sensor can be attached only ego entity.");
+
+  const auto ratios =
+    raycaster_->getVisibleRatios(table.boundingBoxPose(sensor_index).position, targets);
+
+  std::vector<double> visible_ratios(table.size(), 0);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    visible_ratios[indices[i]] = ratios[i];
+  }
+  return visible_ratios;
 }
 
 template <>
 void DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::update(
-  const double current_time, const std::vector<traffic_simulator_msgs::EntityStatus> & status,
-  const rclcpp::Time & stamp, const std::vector<std::string> & lidar_detected_entity)
+  const double current_time, const EntityTable & table, const rclcpp::Time & stamp,
+  const EntityTable::Selection & lidar_detected_entity)
 {
   auto makeObjectClassification = [](const auto & label) {
     autoware_auto_perception_msgs::msg::ObjectClassification object_classification;
@@ -70,20 +80,28 @@ void DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::updat
 
     return object_classification;
   };
-  std::vector<std::string> detected_objects;
-  if (configuration_.filter_by_range()) {
-    detected_objects = getDetectedObjects(status);
-  } else {
-    detected_objects = lidar_detected_entity;
-  }
   if (current_time - last_update_stamp_ - configuration_.update_duration() >= -0.002) {
     autoware_auto_perception_msgs::msg::DetectedObjects msg;
     msg.header.stamp = stamp;
     msg.header.frame_id = "map";
     last_update_stamp_ = current_time;
-    for (const auto & s : status) {
-      auto result = std::find(detected_objects.begin(), detected_objects.end(), s.name());
-      if (result != detected_objects.end()) {
+    std::vector<double> visible_ratios;
+    const auto detected_objects = [&]() {
+      if (configuration_.filter_by_occlusion()) {
+        visible_ratios = getVisibleRatios(table);
+        EntityTable::Selection selection(table.size(), false);
+        for (std::size_t index = 0; index < table.size(); ++index) {
+          selection[index] = configuration_.minimum_visible_ratio() < visible_ratios[index];
+        }
+        return selection;
+      } else if (configuration_.filter_by_range()) {
+        return getDetectedObjects(table);
+      } else {
+        return lidar_detected_entity;
+      }
+    }();
+    for (std::size_t index = 0; index < table.size(); ++index) {
+      if (const auto & s = table.status(index); detected_objects[index]) {
         autoware_auto_perception_msgs::msg::DetectedObject object;
         bool is_ego = false;
         if (s.type().type() == traffic_simulator_msgs::EntityType_Enum::EntityType_Enum_EGO) {
@@ -134,23 +152,16 @@ void DetectionSensor<autoware_auto_perception_msgs::msg::DetectedObjects>::updat
         }
         if (not is_ego) {
           simulation_interface::toMsg(s.bounding_box().dimensions(), object.shape.dimensions);
-          geometry_msgs::msg::Pose pose;
-          simulation_interface::toMsg(s.pose(), pose);
-          auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
-          geometry_msgs::msg::Point center_point;
-          simulation_interface::toMsg(s.bounding_box().center(), center_point);
-          Eigen::Vector3d center(center_point.x, center_point.y, center_point.z);
-          center = rotation * center;
-          pose.position.x = pose.position.x + center.x();
-          pose.position.y = pose.position.y + center.y();
-          pose.position.z = pose.position.z + center.z();
-          object.kinematics.pose_with_covariance.pose = pose;
+          object.kinematics.pose_with_covariance.pose = table.boundingBoxPose(index);
           object.kinematics.pose_with_covariance.covariance = {1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
                                                                0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0,
                                                                0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1};
           simulation_interface::toMsg(
             s.action_status().twist(), object.kinematics.twist_with_covariance.twist);
           object.shape.type = object.shape.BOUNDING_BOX;
+          if (not visible_ratios.empty()) {
+            object.existence_probability = visible_ratios[index];
+          }
           msg.objects.emplace_back(object);
         }
       }
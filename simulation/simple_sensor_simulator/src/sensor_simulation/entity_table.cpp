@@ -0,0 +1,105 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <quaternion_operation/quaternion_operation.h>
+
+#include <cmath>
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
+#include <simulation_interface/conversions.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace simple_sensor_simulator
+{
+EntityTable::EntityTable(const std::vector<traffic_simulator_msgs::EntityStatus> & statuses)
+: statuses_(statuses)
+{
+  indices_.reserve(statuses_.size());
+  bounding_box_poses_.reserve(statuses_.size());
+
+  for (std::size_t index = 0; index < statuses_.size(); ++index) {
+    const auto & s = statuses_[index];
+
+    if (not indices_.emplace(s.name(), index).second) {
+      duplicate_names_.push_back(s.name());
+    }
+
+    geometry_msgs::msg::Pose pose;
+    simulation_interface::toMsg(s.pose(), pose);
+    auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
+    geometry_msgs::msg::Point center_point;
+    simulation_interface::toMsg(s.bounding_box().center(), center_point);
+    Eigen::Vector3d center(center_point.x, center_point.y, center_point.z);
+    center = rotation * center;
+    pose.position.x = pose.position.x + center.x();
+    pose.position.y = pose.position.y + center.y();
+    pose.position.z = pose.position.z + center.z();
+    bounding_box_poses_.push_back(pose);
+  }
+}
+
+auto EntityTable::find(const std::string & name) const -> boost::optional<std::size_t>
+{
+  if (const auto iter = indices_.find(name); iter != std::end(indices_)) {
+    return iter->second;
+  } else {
+    return boost::none;
+  }
+}
+
+auto EntityTable::findEgo(const std::string & name) const -> boost::optional<std::size_t>
+{
+  if (const auto index = find(name);
+      index and statuses_[*index].type().type() == traffic_simulator_msgs::EntityType::EGO) {
+    return index;
+  } else {
+    return boost::none;
+  }
+}
+
+auto EntityTable::select(const std::vector<std::string> & names) const -> Selection
+{
+  Selection selection(size(), false);
+  for (const auto & name : names) {
+    if (const auto index = find(name)) {
+      selection[*index] = true;
+    }
+  }
+  return selection;
+}
+
+auto EntityTable::selectInRange(std::size_t index, double range) const -> Selection
+{
+  auto iter = distances_.find(index);
+
+  if (iter == std::end(distances_)) {
+    const auto & origin = statuses_[index].pose().position();
+    std::vector<double> distances;
+    distances.reserve(size());
+    for (const auto & s : statuses_) {
+      distances.push_back(std::hypot(
+        s.pose().position().x() - origin.x(), s.pose().position().y() - origin.y(),
+        s.pose().position().z() - origin.z()));
+    }
+    iter = distances_.emplace(index, std::move(distances)).first;
+  }
+
+  Selection selection(size(), false);
+  for (std::size_t other = 0; other < size(); ++other) {
+    selection[other] = other != index and iter->second[other] <= range;
+  }
+  return selection;
+}
+}  // namespace simple_sensor_simulator
@@ -12,8 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <quaternion_operation/quaternion_operation.h>
-
 #include <boost/optional.hpp>
 #include <memory>
 #include <simple_sensor_simulator/exception.hpp>
@@ -26,29 +24,18 @@ namespace simple_sensor_simulator
 {
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status, const rclcpp::Time & stamp)
-  -> sensor_msgs::msg::PointCloud2
+  const EntityTable & table, const rclcpp::Time & stamp) -> sensor_msgs::msg::PointCloud2
 {
   boost::optional<geometry_msgs::msg::Pose> ego_pose;
-  for (const auto & s : status) {
-    if (configuration_.entity() == s.name()) {
+  for (std::size_t index = 0; index < table.size(); ++index) {
+    if (const auto & s = table.status(index); configuration_.entity() == s.name()) {
       geometry_msgs::msg::Pose pose;
       simulation_interface::toMsg(s.pose(), pose);
       ego_pose = pose;
     } else {
-      geometry_msgs::msg::Pose pose;
-      simulation_interface::toMsg(s.pose(), pose);
-      auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
-      geometry_msgs::msg::Point center_point;
-      simulation_interface::toMsg(s.bounding_box().center(), center_point);
-      Eigen::Vector3d center(center_point.x, center_point.y, center_point.z);
-      center = rotation * center;
-      pose.position.x = pose.position.x + center.x();
-      pose.position.y = pose.position.y + center.y();
-      pose.position.z = pose.position.z + center.z();
       raycaster_.addPrimitive<simple_sensor_simulator::primitives::Box>(
         s.name(), s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
-        s.bounding_box().dimensions().z(), pose);
+        s.bounding_box().dimensions().z(), table.boundingBoxPose(index));
     }
   }
   if (ego_pose) {
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -90,6 +91,97 @@ const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
 
 const std::vector<std::string> & Raycaster::getDetectedObject() const { return detected_objects_; }
 
+std::vector<double> Raycaster::getVisibleRatios(
+  const geometry_msgs::msg::Point & origin, const std::vector<std::string> & targets)
+{
+  std::unordered_map<std::string, unsigned int> ids;
+  for (auto & pair : primitive_ptrs_) {
+    auto id = pair.second->addToScene(device_, scene_);
+    geometry_ids_.insert({id, pair.first});
+    ids.emplace(pair.first, id);
+  }
+
+  rtcCommitScene(scene_);
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+
+  const Eigen::Vector3d from(origin.x, origin.y, origin.z);
+
+  auto is_visible = [&](const Eigen::Vector3d & to, unsigned int id) {
+    const Eigen::Vector3d direction = to - from;
+    if (const auto distance = direction.norm(); distance == 0) {
+      return true;
+    } else {
+      RTCRayHit rayhit = {};
+      rayhit.ray.org_x = from.x();
+      rayhit.ray.org_y = from.y();
+      rayhit.ray.org_z = from.z();
+      rayhit.ray.dir_x = direction.x() / distance;
+      rayhit.ray.dir_y = direction.y() / distance;
+      rayhit.ray.dir_z = direction.z() / distance;
+      // make raycast interact with all objects
+      rayhit.ray.mask = 0b11111111'11111111'11111111'11111111;
+      rayhit.ray.tnear = 0;
+      rayhit.ray.tfar = distance;
+      rayhit.ray.flags = false;
+      rayhit.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+      rtcIntersect1(scene_, &context, &rayhit);
+      // NOTE: Every sample point is inside of the target, so a ray hitting nothing is not occluded.
+      return rayhit.hit.geomID == RTC_INVALID_GEOMETRY_ID or rayhit.hit.geomID == id;
+    }
+  };
+
+  // NOTE: About a degree, within which rays to the corners almost overlap the one to the center.
+  constexpr double point_like_angle = 0.02;
+
+  // NOTE: The corners are pulled toward the center so that rays do not graze the edges.
+  constexpr double corner_scale = 0.9;
+
+  std::vector<double> visible_ratios;
+  visible_ratios.reserve(targets.size());
+
+  for (const auto & target : targets) {
+    const auto iter = ids.find(target);
+    if (iter == ids.end()) {
+      throw std::runtime_error("primitive " + target + " does not exist.");
+    }
+
+    std::vector<Eigen::Vector3d> corners;
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+    for (const auto & vertex : primitive_ptrs_.at(target)->getVertex()) {
+      corners.emplace_back(vertex.x, vertex.y, vertex.z);
+      center += corners.back();
+    }
+    center /= std::max<std::size_t>(corners.size(), 1);
+
+    double radius = 0;
+    for (const auto & corner : corners) {
+      radius = std::max(radius, (corner - center).norm());
+    }
+
+    if (radius < (center - from).norm() * point_like_angle) {
+      visible_ratios.push_back(is_visible(center, iter->second) ? 1 : 0);
+    } else {
+      std::size_t visible_count = is_visible(center, iter->second) ? 1 : 0;
+      for (const auto & corner : corners) {
+        if (is_visible(center + (corner - center) * corner_scale, iter->second)) {
+          ++visible_count;
+        }
+      }
+      visible_ratios.push_back(static_cast<double>(visible_count) / (corners.size() + 1));
+    }
+  }
+
+  for (const auto & id : geometry_ids_) {
+    rtcDetachGeometry(scene_, id.first);
+  }
+
+  geometry_ids_.clear();
+  primitive_ptrs_.clear();
+
+  return visible_ratios;
+}
+
 const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
   std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
   std::vector<geometry_msgs::msg::Quaternion> directions, double max_distance, double min_distance)
@@ -12,109 +12,64 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <quaternion_operation/quaternion_operation.h>
-
 #include <boost/optional.hpp>
 #include <memory>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <simple_sensor_simulator/exception.hpp>
 #include <simple_sensor_simulator/sensor_simulation/occupancy_grid/occupancy_grid_sensor.hpp>
 #include <simulation_interface/conversions.hpp>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace simple_sensor_simulator
 {
-geometry_msgs::Pose OccupancyGridSensorBase::getSensorPose(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status) const
+auto OccupancyGridSensorBase::getSensorIndex(const EntityTable & table) const -> std::size_t
 {
-  for (const auto & s : status) {
-    if (
-      s.type().type() == traffic_simulator_msgs::EntityType::EGO &&
-      s.name() == configuration_.entity()) {
-      return s.pose();
-    }
+  if (const auto index = table.findEgo(configuration_.entity())) {
+    return *index;
   }
   throw SimulationRuntimeError("Occupancy grid sensor can be attached only ego entity.");
 }
 
-const std::vector<std::string> OccupancyGridSensorBase::getDetectedObjects(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status) const
+auto OccupancyGridSensorBase::getDetectedObjects(const EntityTable & table) const
+  -> EntityTable::Selection
 {
-  std::vector<std::string> detected_entities;
-  const auto pose = getSensorPose(status);
-  for (const auto & s : status) {
-    double distance = std::hypot(
-      s.pose().position().x() - pose.position().x(), s.pose().position().y() - pose.position().y(),
-      s.pose().position().z() - pose.position().z());
-    if (s.name() != configuration_.entity() && distance <= configuration_.range()) {
-      detected_entities.emplace_back(s.name());
-    }
-  }
-  return detected_entities;
+  return table.selectInRange(getSensorIndex(table), configuration_.range());
 }
 
 template <>
 auto OccupancyGridSensor<nav_msgs::msg::OccupancyGrid>::getOccupancyGrid(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status, const rclcpp::Time & stamp,
-  const std::vector<std::string> & lidar_detected_entity) -> nav_msgs::msg::OccupancyGrid
+  const EntityTable & table, const rclcpp::Time & stamp,
+  const EntityTable::Selection & lidar_detected_entity) -> nav_msgs::msg::OccupancyGrid
 {
-  // check if entities in `status` have unique names
-  {
-    auto unique_entities = std::set<std::string>();
-    for (const auto & s : status) {
-      if (configuration_.entity() != s.name()) {
-        if (unique_entities.count(s.name()) != 0) {
-          throw std::runtime_error(
-            "status contains primitives with the same name: `" + s.name() + "`");
-        }
-        unique_entities.insert(s.name());
-      }
+  // check if entities other than ego in `table` have unique names
+  for (const auto & name : table.duplicateNames()) {
+    if (configuration_.entity() != name) {
+      throw std::runtime_error("status contains primitives with the same name: `" + name + "`");
     }
   }
 
-  // find ego from `status` and get its pose with north side up
+  // find ego from `table` and get its pose with north side up
   auto ego_pose_north_up = geometry_msgs::msg::Pose();
-  {
-    auto is_ego = [&](const auto & s) { return configuration_.entity() == s.name(); };
-    auto ego = std::find_if(status.begin(), status.end(), is_ego);
-    if (ego == status.end()) {
-      throw SimulationRuntimeError("Failed to calculate ego pose with north up.");
-    }
-    simulation_interface::toMsg(ego->pose(), ego_pose_north_up);
+  const auto ego = table.find(configuration_.entity());
+  if (not ego) {
+    throw SimulationRuntimeError("Failed to calculate ego pose with north up.");
+  } else {
+    simulation_interface::toMsg(table.status(*ego).pose(), ego_pose_north_up);
     ego_pose_north_up.orientation = geometry_msgs::msg::Quaternion();
   }
 
-  // construct a `set` of detected object names to look up entities later
-  auto detected_entities = std::set<std::string>();
-  {
-    auto v = configuration_.filter_by_range() ? getDetectedObjects(status) : lidar_detected_entity;
-    detected_entities.insert(v.begin(), v.end());
-  }
+  const auto detected_entities =
+    configuration_.filter_by_range() ? getDetectedObjects(table) : lidar_detected_entity;
 
-  // enumerate all primitive shapes of entities
+  // enumerate all primitive shapes of entities actually detected
   auto primitives = std::vector<std::unique_ptr<primitives::Primitive>>();
-  for (const auto & s : status) {
-    if (configuration_.entity() != s.name()) {
-      // skip if entity is not actually detected
-      if (detected_entities.count(s.name()) == 0) {
-        continue;
-      }
-
-      geometry_msgs::msg::Pose pose;
-      simulation_interface::toMsg(s.pose(), pose);
-      auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
-      geometry_msgs::msg::Point center_point;
-      simulation_interface::toMsg(s.bounding_box().center(), center_point);
-      Eigen::Vector3d center(center_point.x, center_point.y, center_point.z);
-      center = rotation * center;
-      pose.position.x = pose.position.x + center.x();
-      pose.position.y = pose.position.y + center.y();
-      pose.position.z = pose.position.z + center.z();
-
+  for (std::size_t index = 0; index < table.size(); ++index) {
+    if (index != *ego and detected_entities[index]) {
+      const auto & dimensions = table.status(index).bounding_box().dimensions();
       primitives.push_back(std::make_unique<primitives::Box>(
-        s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
-        s.bounding_box().dimensions().z(), pose));
+        dimensions.x(), dimensions.y(), dimensions.z(), table.boundingBoxPose(index)));
     }
   }
 
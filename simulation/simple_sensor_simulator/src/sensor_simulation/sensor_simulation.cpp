@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <frame_profiler/frame_profiler.hpp>
 #include <memory>
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
 #include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
 #include <string>
 #include <vector>
@@ -23,21 +25,23 @@ void SensorSimulation::updateSensorFrame(
   double current_time, const rclcpp::Time & current_ros_time,
   const std::vector<traffic_simulator_msgs::EntityStatus> & status)
 {
+  const auto table = EntityTable(status);
+
   std::vector<std::string> lidar_detected_objects = {};
   for (auto & sensor : lidar_sensors_) {
-    sensor->update(current_time, status, current_ros_time);
-    const auto objects = sensor->getDetectedObjects();
-    for (const auto & obj : objects) {
-      if (std::count(lidar_detected_objects.begin(), lidar_detected_objects.end(), obj) == 0) {
-        lidar_detected_objects.push_back(obj);
-      }
-    }
+    frame_profiler::Zone zone("LidarSensor::update");
+    sensor->update(current_time, table, current_ros_time);
+    const auto & objects = sensor->getDetectedObjects();
+    lidar_detected_objects.insert(lidar_detected_objects.end(), objects.begin(), objects.end());
   }
+  const auto lidar_detected_entities = table.select(lidar_detected_objects);
   for (auto & sensor : detection_sensors_) {
-    sensor->update(current_time, status, current_ros_time, lidar_detected_objects);
+    frame_profiler::Zone zone("DetectionSensor::update");
+    sensor->update(current_time, table, current_ros_time, lidar_detected_entities);
   }
   for (auto & sensor : occupancy_grid_sensors_) {
-    sensor->update(current_time, status, current_ros_time, lidar_detected_objects);
+    frame_profiler::Zone zone("OccupancyGridSensor::update");
+    sensor->update(current_time, table, current_ros_time, lidar_detected_entities);
   }
 }
 }  // namespace simple_sensor_simulator
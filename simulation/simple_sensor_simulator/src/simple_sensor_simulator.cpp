@@ -14,6 +14,7 @@
 
 #include <quaternion_operation/quaternion_operation.h>
 
+#include <frame_profiler/frame_profiler.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <limits>
 #include <memory>
@@ -58,11 +59,27 @@ ScenarioSimulator::ScenarioSimulator(const rclcpp::NodeOptions & options)
       &ScenarioSimulator::attachOccupancyGridSensor, this, std::placeholders::_1,
       std::placeholders::_2),
     std::bind(
-      &ScenarioSimulator::updateTrafficLights, this, std::placeholders::_1, std::placeholders::_2))
+      &ScenarioSimulator::updateTrafficLights, this, std::placeholders::_1, std::placeholders::_2),
+    declare_parameter<int>("port_offset", 0)),
+  profiler_diagnostics_pub_(create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+    "frame_profiler/diagnostics", rclcpp::QoS(1)))
 {
+  if (declare_parameter<bool>("profile", false)) {
+    frame_profiler::Profiler::enable(true);
+    if (const auto path = declare_parameter<std::string>("profile_trace_path", "");
+        not path.empty()) {
+      frame_profiler::Profiler::startTrace(path);
+    }
+    profiler_diagnostics_timer_ = create_wall_timer(std::chrono::seconds(1), [this]() {
+      auto diagnostic_array =
+        frame_profiler::Profiler::makeDiagnosticArray("simple_sensor_simulator/");
+      diagnostic_array.header.stamp = now();
+      profiler_diagnostics_pub_->publish(diagnostic_array);
+    });
+  }
 }
 
-ScenarioSimulator::~ScenarioSimulator() {}
+ScenarioSimulator::~ScenarioSimulator() { frame_profiler::Profiler::stopTrace(); }
 
 void ScenarioSimulator::initialize(
   const simulation_api_schema::InitializeRequest & req,
@@ -77,6 +94,9 @@ void ScenarioSimulator::initialize(
   ego_vehicles_ = {};
   vehicles_ = {};
   pedestrians_ = {};
+  misc_objects_ = {};
+  entity_status_ = {};
+  sensor_sim_ = SensorSimulation();  // NOTE: Sensors are attached again by each scenario.
 }
 
 void ScenarioSimulator::updateFrame(
@@ -218,6 +238,7 @@ void ScenarioSimulator::updateSensorFrame(
   const simulation_api_schema::UpdateSensorFrameRequest & req,
   simulation_api_schema::UpdateSensorFrameResponse & res)
 {
+  frame_profiler::Zone zone("ScenarioSimulator::updateSensorFrame");
   constexpr double e = std::numeric_limits<double>::epsilon();
   if (std::abs(req.current_time() - current_time_) > e) {
     res.mutable_result()->set_success(false);
@@ -0,0 +1,125 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <simple_sensor_simulator/sensor_simulation/entity_table.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+auto makeStatus(const std::string & name, traffic_simulator_msgs::EntityType::Enum type, double x)
+{
+  traffic_simulator_msgs::EntityStatus status;
+  status.set_name(name);
+  status.mutable_type()->set_type(type);
+  status.mutable_pose()->mutable_position()->set_x(x);
+  status.mutable_pose()->mutable_orientation()->set_w(1);
+  return status;
+}
+
+/*
+   The ego at the origin, and the others 5 m, 10 m and 10.5 m ahead of it.
+*/
+auto makeStatuses()
+{
+  return std::vector<traffic_simulator_msgs::EntityStatus>{
+    makeStatus("ego", traffic_simulator_msgs::EntityType::EGO, 0.0),
+    makeStatus("near", traffic_simulator_msgs::EntityType::VEHICLE, 5.0),
+    makeStatus("boundary", traffic_simulator_msgs::EntityType::PEDESTRIAN, 10.0),
+    makeStatus("far", traffic_simulator_msgs::EntityType::VEHICLE, 10.5)};
+}
+}  // namespace
+
+TEST(EntityTable, find)
+{
+  const auto statuses = makeStatuses();
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  ASSERT_EQ(table.size(), statuses.size());
+  for (std::size_t index = 0; index < statuses.size(); ++index) {
+    ASSERT_TRUE(table.find(statuses[index].name()));
+    EXPECT_EQ(table.find(statuses[index].name()).get(), index);
+  }
+  EXPECT_FALSE(table.find("unknown"));
+  EXPECT_TRUE(table.duplicateNames().empty());
+}
+
+TEST(EntityTable, findEgo)
+{
+  const auto statuses = makeStatuses();
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  ASSERT_TRUE(table.findEgo("ego"));
+  EXPECT_EQ(table.findEgo("ego").get(), static_cast<std::size_t>(0));
+  EXPECT_FALSE(table.findEgo("near"));
+  EXPECT_FALSE(table.findEgo("boundary"));
+  EXPECT_FALSE(table.findEgo("unknown"));
+}
+
+TEST(EntityTable, select)
+{
+  const auto statuses = makeStatuses();
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  EXPECT_EQ(table.select({}), std::vector<bool>({false, false, false, false}));
+  EXPECT_EQ(table.select({"far", "unknown"}), std::vector<bool>({false, false, false, true}));
+  EXPECT_EQ(table.select({"near", "ego", "near"}), std::vector<bool>({true, true, false, false}));
+}
+
+TEST(EntityTable, selectInRange)
+{
+  const auto statuses = makeStatuses();
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  // NOTE: The given entity is never selected, and an entity just at the range is.
+  EXPECT_EQ(table.selectInRange(0, 10.0), std::vector<bool>({false, true, true, false}));
+  EXPECT_EQ(table.selectInRange(0, 0.0), std::vector<bool>({false, false, false, false}));
+  EXPECT_EQ(table.selectInRange(0, 100.0), std::vector<bool>({false, true, true, true}));
+  EXPECT_EQ(table.selectInRange(3, 0.5), std::vector<bool>({false, false, true, false}));
+}
+
+TEST(EntityTable, selectInRangeReusesDistances)
+{
+  auto statuses = makeStatuses();
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  EXPECT_EQ(table.selectInRange(0, 10.0), std::vector<bool>({false, true, true, false}));
+  /*
+     The distances from the ego were computed by the first selection, so the
+     second one does not see that the entity moved. This is why a table is
+     built again on each frame.
+  */
+  statuses[1].mutable_pose()->mutable_position()->set_x(50.0);
+  EXPECT_EQ(table.selectInRange(0, 10.0), std::vector<bool>({false, true, true, false}));
+  EXPECT_EQ(table.selectInRange(0, 5.0), std::vector<bool>({false, true, false, false}));
+  EXPECT_EQ(
+    simple_sensor_simulator::EntityTable(statuses).selectInRange(0, 10.0),
+    std::vector<bool>({false, false, true, false}));
+}
+
+TEST(EntityTable, duplicateNames)
+{
+  auto statuses = makeStatuses();
+  statuses.push_back(makeStatus("near", traffic_simulator_msgs::EntityType::VEHICLE, 20.0));
+  statuses.push_back(makeStatus("ego", traffic_simulator_msgs::EntityType::EGO, 30.0));
+  const auto table = simple_sensor_simulator::EntityTable(statuses);
+  EXPECT_EQ(table.duplicateNames(), std::vector<std::string>({"near", "ego"}));
+  ASSERT_TRUE(table.find("near"));
+  EXPECT_EQ(table.find("near").get(), static_cast<std::size_t>(1));
+  ASSERT_TRUE(table.findEgo("ego"));
+  EXPECT_EQ(table.findEgo("ego").get(), static_cast<std::size_t>(0));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
+#include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+auto makePose(double x, double y, double z)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.position.z = z;
+  return pose;
+}
+}  // namespace
+
+/*
+   Seen from the origin, a wall 5 m ahead hides a box 10 m ahead, while
+   another box 10 m ahead and 10 m to the left is in the clear.
+*/
+TEST(Raycaster, getVisibleRatios)
+{
+  simple_sensor_simulator::Raycaster raycaster;
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "wall", 1.0, 4.0, 4.0, makePose(5.0, 0.0, 0.0));
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "occluded", 1.0, 1.0, 1.0, makePose(10.0, 0.0, 0.0));
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "clear", 1.0, 1.0, 1.0, makePose(10.0, 10.0, 0.0));
+  const auto ratios =
+    raycaster.getVisibleRatios(geometry_msgs::msg::Point(), {"occluded", "clear", "wall"});
+  ASSERT_EQ(ratios.size(), static_cast<std::size_t>(3));
+  EXPECT_NEAR(ratios[0], 0.0, 1e-3);
+  EXPECT_NEAR(ratios[1], 1.0, 1e-3);
+  EXPECT_NEAR(ratios[2], 1.0, 1e-3);
+}
+
+/*
+   Seen from the origin, the wall covers only the right half of a box 10 m
+   ahead, so some of the rays to it are occluded and some are not.
+*/
+TEST(Raycaster, getVisibleRatiosOfPartiallyOccluded)
+{
+  simple_sensor_simulator::Raycaster raycaster;
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "wall", 1.0, 4.0, 4.0, makePose(5.0, -2.5, 0.0));
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "target", 1.0, 4.0, 2.0, makePose(10.0, 0.0, 0.0));
+  const auto ratios = raycaster.getVisibleRatios(geometry_msgs::msg::Point(), {"target"});
+  ASSERT_EQ(ratios.size(), static_cast<std::size_t>(1));
+  EXPECT_GT(ratios[0], 0.0);
+  EXPECT_LT(ratios[0], 1.0);
+}
+
+TEST(Raycaster, getVisibleRatiosRemovesPrimitives)
+{
+  simple_sensor_simulator::Raycaster raycaster;
+  raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "target", 1.0, 1.0, 1.0, makePose(10.0, 0.0, 0.0));
+  EXPECT_EQ(
+    raycaster.getVisibleRatios(geometry_msgs::msg::Point(), {"target"}),
+    std::vector<double>({1.0}));
+  EXPECT_THROW(
+    raycaster.getVisibleRatios(geometry_msgs::msg::Point(), {"target"}), std::runtime_error);
+  EXPECT_NO_THROW(raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
+    "target", 1.0, 1.0, 1.0, makePose(10.0, 0.0, 0.0)));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -32,8 +32,13 @@ namespace zeromq
 class MultiClient
 {
 public:
+  /*
+     The port_offset is added to every port in simulation_interface::ports, so
+     that several simulators can run on the same host at the same time.
+  */
   explicit MultiClient(
-    const simulation_interface::TransportProtocol & protocol, const std::string & hostname);
+    const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+    const unsigned int port_offset = 0);
   ~MultiClient();
 
   void call(
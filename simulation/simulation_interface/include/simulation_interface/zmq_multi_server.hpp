@@ -80,7 +80,8 @@ public:
     std::function<void(
       const simulation_api_schema::UpdateTrafficLightsRequest &,
       simulation_api_schema::UpdateTrafficLightsResponse &)>
-      update_traffic_lights_func);
+      update_traffic_lights_func,
+    const unsigned int port_offset = 0);
   ~MultiServer();
 
 private:
@@ -19,7 +19,8 @@
 namespace zeromq
 {
 MultiClient::MultiClient(
-  const simulation_interface::TransportProtocol & protocol, const std::string & hostname)
+  const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+  const unsigned int port_offset)
 : protocol(protocol),
   hostname(hostname),
   context_(zmqpp::context()),
@@ -37,30 +38,24 @@ MultiClient::MultiClient(
   socket_attach_occupancy_grid_sensor_(context_, type_),
   socket_update_traffic_lights_(context_, type_)
 {
-  socket_initialize_.connect(
-    simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
-  socket_update_frame_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_frame));
-  socket_update_sensor_frame_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_sensor_frame));
-  socket_spawn_vehicle_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity));
-  socket_spawn_pedestrian_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity));
-  socket_spawn_misc_object_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity));
-  socket_despawn_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::despawn_entity));
-  socket_update_entity_status_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_entity_status));
-  socket_attach_lidar_sensor_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_lidar_sensor));
-  socket_attach_detection_sensor_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_detection_sensor));
-  socket_attach_occupancy_grid_sensor_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_occupancy_grid_sensor));
-  socket_update_traffic_lights_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_traffic_lights));
+  namespace ports = simulation_interface::ports;
+
+  const auto end_point = [&](const unsigned int port) {
+    return simulation_interface::getEndPoint(protocol, hostname, port + port_offset);
+  };
+
+  socket_initialize_.connect(end_point(ports::initialize));
+  socket_update_frame_.connect(end_point(ports::update_frame));
+  socket_update_sensor_frame_.connect(end_point(ports::update_sensor_frame));
+  socket_spawn_vehicle_entity_.connect(end_point(ports::spawn_vehicle_entity));
+  socket_spawn_pedestrian_entity_.connect(end_point(ports::spawn_pedestrian_entity));
+  socket_spawn_misc_object_entity_.connect(end_point(ports::spawn_misc_object_entity));
+  socket_despawn_entity_.connect(end_point(ports::despawn_entity));
+  socket_update_entity_status_.connect(end_point(ports::update_entity_status));
+  socket_attach_lidar_sensor_.connect(end_point(ports::attach_lidar_sensor));
+  socket_attach_detection_sensor_.connect(end_point(ports::attach_detection_sensor));
+  socket_attach_occupancy_grid_sensor_.connect(end_point(ports::attach_occupancy_grid_sensor));
+  socket_update_traffic_lights_.connect(end_point(ports::update_traffic_lights));
 
   rclcpp::on_shutdown([this] { is_running = false; });
 }
@@ -67,7 +67,8 @@ MultiServer::MultiServer(
   std::function<void(
     const simulation_api_schema::UpdateTrafficLightsRequest &,
     simulation_api_schema::UpdateTrafficLightsResponse &)>
-    update_traffic_lights_func)
+    update_traffic_lights_func,
+  const unsigned int port_offset)
 : context_(zmqpp::context()),
   type_(zmqpp::socket_type::reply),
   initialize_sock_(context_, type_),
@@ -95,30 +96,24 @@ MultiServer::MultiServer(
   update_traffic_lights_sock_(context_, type_),
   update_traffic_lights_func_(update_traffic_lights_func)
 {
-  initialize_sock_.bind(
-    simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
-  update_entity_status_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_entity_status));
-  update_frame_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_frame));
-  spawn_vehicle_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity));
-  spawn_pedestrian_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity));
-  spawn_misc_object_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity));
-  despawn_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::despawn_entity));
-  update_sensor_frame_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_sensor_frame));
-  attach_lidar_sensor_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_lidar_sensor));
-  attach_detection_sensor_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_detection_sensor));
-  attach_occupancy_grid_sensor_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_occupancy_grid_sensor));
-  update_traffic_lights_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_traffic_lights));
+  namespace ports = simulation_interface::ports;
+
+  const auto end_point = [&](const unsigned int port) {
+    return simulation_interface::getEndPoint(protocol, hostname, port + port_offset);
+  };
+
+  initialize_sock_.bind(end_point(ports::initialize));
+  update_entity_status_sock_.bind(end_point(ports::update_entity_status));
+  update_frame_sock_.bind(end_point(ports::update_frame));
+  spawn_vehicle_entity_sock_.bind(end_point(ports::spawn_vehicle_entity));
+  spawn_pedestrian_entity_sock_.bind(end_point(ports::spawn_pedestrian_entity));
+  spawn_misc_object_entity_sock_.bind(end_point(ports::spawn_misc_object_entity));
+  despawn_entity_sock_.bind(end_point(ports::despawn_entity));
+  update_sensor_frame_sock_.bind(end_point(ports::update_sensor_frame));
+  attach_lidar_sensor_sock_.bind(end_point(ports::attach_lidar_sensor));
+  attach_detection_sensor_sock_.bind(end_point(ports::attach_detection_sensor));
+  attach_occupancy_grid_sensor_sock_.bind(end_point(ports::attach_occupancy_grid_sensor));
+  update_traffic_lights_sock_.bind(end_point(ports::update_traffic_lights));
   poller_.add(initialize_sock_);
   poller_.add(update_frame_sock_);
   poller_.add(update_sensor_frame_sock_);
@@ -0,0 +1,111 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cstdint>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <unordered_set>
+#include <vector>
+
+#include "catalogs.hpp"
+
+namespace
+{
+/*
+   Lanelet poses 15 m apart along the roads followed from the starting
+   lanelets of cpp_mock_scenarios/traffic_simulation_demo, so that the NPCs
+   spawned there follow each other instead of overlapping.
+*/
+auto makeLaneletPoses(hdmap_utils::HdMapUtils & hdmap_utils, std::size_t size)
+{
+  std::vector<traffic_simulator_msgs::msg::LaneletPose> lanelet_poses;
+  std::unordered_set<std::int64_t> visited_lanelet_ids;
+  for (const auto start_lanelet_id : {34513, 34579, 34615, 34741}) {
+    for (const auto lanelet_id : hdmap_utils.getFollowingLanelets(start_lanelet_id, 5000)) {
+      if (visited_lanelet_ids.insert(lanelet_id).second) {
+        for (double s = 0; s < hdmap_utils.getLaneletLength(lanelet_id); s += 15) {
+          if (lanelet_poses.size() < size) {
+            lanelet_poses.push_back(traffic_simulator::helper::constructLaneletPose(lanelet_id, s));
+          }
+        }
+      }
+    }
+  }
+  return lanelet_poses;
+}
+}  // namespace
+
+/*
+   One iteration is one frame (50 ms of simulation time) of EntityManager
+   with the given number of NPC vehicles, each driving at 5 m/s by the
+   default behavior.
+*/
+static void Update(benchmark::State & state)
+{
+  auto node = std::make_shared<rclcpp::Node>("benchmark_entity_manager");
+
+  auto entity_manager = traffic_simulator::entity::EntityManager(
+    node, traffic_simulator::Configuration(
+            ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map"));
+
+  const auto lanelet_poses = makeLaneletPoses(*entity_manager.getHdmapUtils(), state.range(0));
+
+  if (lanelet_poses.size() < static_cast<std::size_t>(state.range(0))) {
+    state.SkipWithError("There is not enough room for the NPCs in the map.");
+    return;
+  }
+
+  for (std::size_t i = 0; i < lanelet_poses.size(); ++i) {
+    const auto name = "npc" + std::to_string(i);
+    entity_manager.spawnEntity<traffic_simulator::entity::VehicleEntity>(
+      name, lanelet_poses[i], getVehicleParameters());
+    entity_manager.requestSpeedChange(name, 5, true);
+  }
+
+  entity_manager.startNpcLogic();
+
+  constexpr double step_time = 0.05;
+
+  double current_time = 0;
+
+  for (auto _ : state) {
+    entity_manager.update(current_time, step_time);
+    current_time += step_time;
+  }
+
+  state.SetItemsProcessed(state.iterations() * lanelet_poses.size());
+}
+
+/*
+   NOTE: The number of iterations is fixed, since the setup (loading the map
+   and spawning the NPCs) is too expensive to be repeated while Google
+   Benchmark estimates it, and since the cost of a frame depends on how far
+   the NPCs have driven.
+*/
+BENCHMARK(Update)->Arg(1)->Arg(10)->Arg(100)->Iterations(200)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,156 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <utility>
+#include <vector>
+
+namespace
+{
+auto makeHdMapUtils(std::size_t route_cache_capacity)
+{
+  /*
+     NOTE: The origin is not used by HdMapUtils, since the map is projected by
+     MGRS.
+  */
+  return std::make_unique<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map/lanelet2_map.osm",
+    geographic_msgs::msg::GeoPoint(), route_cache_capacity);
+}
+
+auto hdmapUtils() -> hdmap_utils::HdMapUtils &
+{
+  static auto hdmap_utils = makeHdMapUtils(4096);
+  return *hdmap_utils;
+}
+
+/*
+   The routes requested by cpp_mock_scenarios/traffic_simulation_demo.
+*/
+constexpr std::array<std::pair<std::int64_t, std::int64_t>, 3> routes = {
+  {{34615, 35026}, {34579, 34675}, {34513, 34630}}};
+
+/*
+   Poses slightly (0.3 m) off the centerline of the first lanelets of the
+   map, which is where entities usually are when matched to the lane.
+*/
+auto makePoses()
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (const auto lanelet_id : hdmapUtils().getLaneletIds()) {
+    if (poses.size() < 64) {
+      poses.push_back(hdmapUtils().toMapPose(lanelet_id, 1.0, 0.3).pose);
+    }
+  }
+  return poses;
+}
+}  // namespace
+
+static void ToLaneletPose(benchmark::State & state)
+{
+  const auto poses = makePoses();
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(hdmapUtils().toLaneletPose(pose, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+
+BENCHMARK(ToLaneletPose)->Unit(benchmark::kMicrosecond);
+
+static void ToLaneletPoseWithBoundingBox(benchmark::State & state)
+{
+  const auto poses = makePoses();
+  traffic_simulator_msgs::msg::BoundingBox bounding_box;
+  bounding_box.center.x = 1.5;
+  bounding_box.dimensions.x = 4.5;
+  bounding_box.dimensions.y = 2.1;
+  bounding_box.dimensions.z = 1.8;
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(hdmapUtils().toLaneletPose(pose, bounding_box, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+
+BENCHMARK(ToLaneletPoseWithBoundingBox)->Unit(benchmark::kMicrosecond);
+
+static void GetRoute(benchmark::State & state)
+{
+  for (auto _ : state) {
+    for (const auto & [from, to] : routes) {
+      benchmark::DoNotOptimize(hdmapUtils().getRoute(from, to));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * routes.size());
+}
+
+BENCHMARK(GetRoute)->Unit(benchmark::kMicrosecond);
+
+/*
+   Every lookup misses the route cache (holding only one route, while the
+   requested routes are cycled through), so this measures the routing graph
+   search itself.
+*/
+static void GetRouteWithoutCache(benchmark::State & state)
+{
+  static auto hdmap_utils = makeHdMapUtils(1);
+  for (auto _ : state) {
+    for (const auto & [from, to] : routes) {
+      benchmark::DoNotOptimize(hdmap_utils->getRoute(from, to));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * routes.size());
+}
+
+BENCHMARK(GetRouteWithoutCache)->Unit(benchmark::kMicrosecond);
+
+static void GetFollowingLanelets(benchmark::State & state)
+{
+  for (auto _ : state) {
+    for (const auto & route : routes) {
+      benchmark::DoNotOptimize(hdmapUtils().getFollowingLanelets(route.first, state.range(0)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * routes.size());
+}
+
+BENCHMARK(GetFollowingLanelets)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+static void GetFollowingLaneletsAlongRoute(benchmark::State & state)
+{
+  std::vector<std::vector<std::int64_t>> candidates;
+  for (const auto & [from, to] : routes) {
+    candidates.push_back(hdmapUtils().getRoute(from, to));
+  }
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < routes.size(); ++i) {
+      benchmark::DoNotOptimize(
+        hdmapUtils().getFollowingLanelets(routes[i].first, candidates[i], state.range(0)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * routes.size());
+}
+
+BENCHMARK(GetFollowingLaneletsAlongRoute)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
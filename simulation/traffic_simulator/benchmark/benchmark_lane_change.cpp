@@ -0,0 +1,75 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <memory>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+#include "lane_change_by_brute_force.hpp"
+
+namespace
+{
+auto hdmapUtils() -> hdmap_utils::HdMapUtils &
+{
+  static auto hdmap_utils = []() {
+    geographic_msgs::msg::GeoPoint origin;
+    origin.latitude = 35.61836750154;
+    origin.longitude = 139.78066608243;
+    return std::make_unique<hdmap_utils::HdMapUtils>(
+      ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+      origin);
+  }();
+  return *hdmap_utils;
+}
+
+constexpr std::int64_t from_lanelet_id = 34462;
+
+constexpr std::int64_t to_lanelet_id = 34513;
+}  // namespace
+
+/*
+   The arguments are the same as the ones LaneChangeAction gives when the lane
+   change is not constrained.
+*/
+static void LaneChangeTrajectory(benchmark::State & state)
+{
+  const auto from_pose = hdmapUtils().toMapPose(from_lanelet_id, 5.0, 0).pose;
+  const auto parameter =
+    traffic_simulator::lane_change::Parameter(traffic_simulator::lane_change::AbsoluteTarget(
+      to_lanelet_id, 0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      hdmapUtils().getLaneChangeTrajectory(from_pose, parameter, 10.0, 20.0, 1.0));
+  }
+  state.counters["target_lanelet_length"] = hdmapUtils().getLaneletLength(to_lanelet_id);
+}
+
+static void LaneChangeTrajectoryByBruteForce(benchmark::State & state)
+{
+  const auto from_pose = hdmapUtils().toMapPose(from_lanelet_id, 5.0, 0).pose;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      getLaneChangeTrajectoryByBruteForce(hdmapUtils(), from_pose, to_lanelet_id, 10.0, 20.0, 1.0));
+  }
+  state.counters["target_lanelet_length"] = hdmapUtils().getLaneletLength(to_lanelet_id);
+}
+
+BENCHMARK(LaneChangeTrajectory)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(LaneChangeTrajectoryByBruteForce)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
+#include <tuple>
+
+namespace
+{
+using traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner;
+
+/*
+   Stopping from 20 m/s at 0.1 m/s^2 and 30 fps, i.e. a gentle deceleration
+   that takes thousands of steps to simulate.
+*/
+auto makeConstraints()
+{
+  traffic_simulator_msgs::msg::DynamicConstraints constraints;
+  constraints.max_speed = 30.0;
+  constraints.max_acceleration = 0.1;
+  constraints.max_acceleration_rate = 0.1;
+  constraints.max_deceleration = 0.1;
+  constraints.max_deceleration_rate = 0.1;
+  return constraints;
+}
+
+auto makeTwist()
+{
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = 20.0;
+  return twist;
+}
+}  // namespace
+
+static void RunningDistance(benchmark::State & state)
+{
+  const auto planner = LongitudinalSpeedPlanner(1.0 / 30, "entity");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(planner.getRunningDistance(
+      0.0, makeConstraints(), makeTwist(), geometry_msgs::msg::Accel(), 0.0));
+  }
+}
+
+/*
+   What getRunningDistance did before it was solved in closed form.
+*/
+static void RunningDistanceBySimulation(benchmark::State & state)
+{
+  const auto planner = LongitudinalSpeedPlanner(1.0 / 30, "entity");
+  for (auto _ : state) {
+    auto dynamic_states = std::make_tuple(makeTwist(), geometry_msgs::msg::Accel(), 0.0);
+    double distance = 0;
+    do {
+      dynamic_states = planner.getDynamicStates(
+        0.0, makeConstraints(), std::get<0>(dynamic_states), std::get<1>(dynamic_states));
+      distance += std::get<0>(dynamic_states).linear.x * planner.step_time +
+                  std::get<1>(dynamic_states).linear.x * planner.step_time * planner.step_time / 2 +
+                  std::get<2>(dynamic_states) * planner.step_time * planner.step_time *
+                    planner.step_time / 6;
+    } while (not planner.isTargetSpeedReached(0.0, std::get<0>(dynamic_states), 0.01));
+    benchmark::DoNotOptimize(distance);
+  }
+}
+
+BENCHMARK(RunningDistance);
+
+BENCHMARK(RunningDistanceBySimulation)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -21,6 +21,8 @@
 #include <autoware_auto_vehicle_msgs/msg/vehicle_state_command.hpp>
 #include <boost/variant.hpp>
 #include <cassert>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <frame_profiler/frame_profiler.hpp>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <rosgraph_msgs/msg/clock.hpp>
@@ -75,12 +77,30 @@ public:
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     debug_marker_pub_(rclcpp::create_publisher<visualization_msgs::msg::MarkerArray>(
       node, "debug_marker", rclcpp::QoS(100), rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
-    zeromq_client_(simulation_interface::protocol, configuration.simulator_host)
+    clock_(RCL_ROS_TIME, not configuration.free_running),
+    profiler_diagnostics_pub_(rclcpp::create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+      node, "frame_profiler/diagnostics", rclcpp::QoS(1),
+      rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
+    zeromq_client_(
+      simulation_interface::protocol, configuration.simulator_host, configuration.port_offset)
   {
     metrics_manager_.setEntityManager(entity_manager_ptr_);
     setVerbose(configuration.verbose);
+    frame_profiler::Profiler::enable(configuration.profile);
+    if (configuration.profile) {
+      if (not configuration.profile_trace_path.empty()) {
+        frame_profiler::Profiler::startTrace(configuration.profile_trace_path.string());
+      }
+      profiler_diagnostics_timer_ = node->create_wall_timer(std::chrono::seconds(1), [this]() {
+        auto diagnostic_array = frame_profiler::Profiler::makeDiagnosticArray("traffic_simulator/");
+        diagnostic_array.header.stamp = clock_.getCurrentRosTimeAsMsg().clock;
+        profiler_diagnostics_pub_->publish(diagnostic_array);
+      });
+    }
   }
 
+  ~API();
+
   template <typename T, typename... Ts>
   void addMetric(const std::string & name, Ts &&... xs)
   {
@@ -229,6 +249,14 @@ public:
 
   bool initialize(double realtime_factor, double step_time);
 
+  /*
+     Despawns all entities and forgets every state specific to the scenario
+     (traffic lights, metrics and the start of the NPC logic), but keeps the
+     loaded map, the routing graphs and the connection to the simulator. The
+     API must be initialized again before the next updateFrame.
+  */
+  void reset();
+
   bool updateFrame();
 
   double getCurrentTime() const noexcept { return clock_.getCurrentScenarioTime(); }
@@ -276,6 +304,7 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getDistanceToRightLaneBound);
   FORWARD_TO_ENTITY_MANAGER(getEgoName);
   FORWARD_TO_ENTITY_MANAGER(getEntityNames);
+  FORWARD_TO_ENTITY_MANAGER(getHdmapUtils);
   FORWARD_TO_ENTITY_MANAGER(getLaneletPose);
   FORWARD_TO_ENTITY_MANAGER(getLinearJerk);
   FORWARD_TO_ENTITY_MANAGER(getLongitudinalDistance);
@@ -322,6 +351,11 @@ private:
 
   traffic_simulator::SimulationClock clock_;
 
+  const rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr
+    profiler_diagnostics_pub_;
+
+  rclcpp::TimerBase::SharedPtr profiler_diagnostics_timer_;
+
   zeromq::MultiClient zeromq_client_;
 };
 }  // namespace traffic_simulator
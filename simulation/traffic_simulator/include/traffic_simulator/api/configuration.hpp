@@ -20,6 +20,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <cstddef>
 #include <iomanip>
 #include <scenario_simulator_exception/exception.hpp>
 #include <string>
@@ -38,10 +39,58 @@ struct Configuration
 
   bool standalone_mode = false;
 
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  When the simulation is stepped as fast as possible instead of at a fixed
+   *  wall clock rate, the ROS time published to /clock is derived from the
+   *  simulation time instead of the system clock, so that the two stay
+   *  consistent regardless of how long each step actually takes.
+   *
+   * ------------------------------------------------------------------------ */
+  bool free_running = false;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  The transform of every entity is broadcast to TF on each frame so that
+   *  it can be seen in RViz. In headless runs nobody looks at the NPCs, so
+   *  their transforms can be omitted and only the one of the ego is sent.
+   *
+   * ------------------------------------------------------------------------ */
+  bool broadcast_npc_tf = true;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  The entity statuses for visualization ("entity/status") are published at
+   *  most entity_status_rate times per second of wall clock time, or on every
+   *  frame if it is not positive. The waypoints in them are thinned out so
+   *  that the removed ones are within waypoint_tolerance meters of the rest.
+   *  Neither affects the simulation itself.
+   *
+   * ------------------------------------------------------------------------ */
+  double entity_status_rate = 0;
+
+  double waypoint_tolerance = 0.1;
+
   double initialize_duration = 0;
 
   std::string simulator_host = "localhost";
 
+  unsigned int port_offset = 0;  // NOTE: Added to each port of simulation_interface::ports.
+
+  std::size_t route_cache_capacity = 4096;  // NOTE: The number of routes, not bytes.
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  When profile is true, the time spent in each frame_profiler::Zone is
+   *  published to "frame_profiler/diagnostics" once a second. When
+   *  profile_trace_path is also given, every zone is written there as a
+   *  Chrome trace event file when the API is destroyed.
+   *
+   * ------------------------------------------------------------------------ */
+  bool profile = false;
+
+  Pathname profile_trace_path = "";
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
@@ -139,6 +188,27 @@ struct Configuration
 
   auto lanelet2_map_path() const { return map_path / lanelet2_map_file; }
 
+  /*
+     Whether an API constructed with the given configuration can be reset and
+     reused for this configuration, i.e. whether they load the same map and
+     talk to the same simulator in the same way.
+  */
+  auto isCompatibleWith(const Configuration & other) const -> bool
+  {
+    return lanelet2_map_path() == other.lanelet2_map_path() and
+           pointcloud_map_path() == other.pointcloud_map_path() and
+           auto_sink == other.auto_sink and free_running == other.free_running and
+           broadcast_npc_tf == other.broadcast_npc_tf and
+           entity_status_rate == other.entity_status_rate and
+           waypoint_tolerance == other.waypoint_tolerance and
+           standalone_mode == other.standalone_mode and simulator_host == other.simulator_host and
+           port_offset == other.port_offset and
+           route_cache_capacity == other.route_cache_capacity and
+           profile == other.profile and profile_trace_path == other.profile_trace_path and
+           metrics_log_path == other.metrics_log_path and
+           rviz_config_path == other.rviz_config_path;
+  }
+
   auto pointcloud_map_path() const { return map_path / pointcloud_map_file; }
 };
 }  // namespace traffic_simulator
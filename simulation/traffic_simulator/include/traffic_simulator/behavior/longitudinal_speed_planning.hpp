@@ -56,6 +56,10 @@ public:
   const std::string entity;
 
 private:
+  auto getRunningDistanceWithPiecewiseConstantJerk(
+    double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
+    const geometry_msgs::msg::Twist & current_twist,
+    const geometry_msgs::msg::Accel & current_accel, double tolerance) const -> double;
   auto isReachedToTargetSpeedWithConstantJerk(
     double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
     const geometry_msgs::msg::Twist & current_twist,
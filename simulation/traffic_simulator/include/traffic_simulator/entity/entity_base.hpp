@@ -97,6 +97,8 @@ public:
 
   virtual auto getGoalPoses() -> std::vector<traffic_simulator_msgs::msg::LaneletPose> = 0;
 
+  /*   */ auto getJobStatistics() const -> job::JobList::Statistics;
+
   /*   */ auto getLinearJerk() const -> double;
 
   /*   */ auto getLaneletPose() const -> boost::optional<traffic_simulator_msgs::msg::LaneletPose>;
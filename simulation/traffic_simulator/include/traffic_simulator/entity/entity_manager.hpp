@@ -26,6 +26,7 @@
 #endif
 
 #include <boost/optional.hpp>
+#include <chrono>
 #include <memory>
 #include <rclcpp/node_interfaces/get_node_topics_interface.hpp>
 #include <rclcpp/node_interfaces/node_topics_interface.hpp>
@@ -93,6 +94,19 @@ class EntityManager
     traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray;
   const rclcpp::Publisher<EntityStatusWithTrajectoryArray>::SharedPtr entity_status_array_pub_ptr_;
 
+  std::chrono::steady_clock::time_point entity_status_array_published_time_;
+
+  std::size_t entity_status_array_subscription_count_ = 0;
+
+  std::size_t entity_status_array_publish_count_ = 0;
+
+  /*
+     The waypoint and goal_pose of each entity as last published. They are
+     left empty in the next message unless they have changed.
+  */
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatusWithTrajectory>
+    published_trajectories_;
+
   using MarkerArray = visualization_msgs::msg::MarkerArray;
   const rclcpp::Publisher<MarkerArray>::SharedPtr lanelet_marker_pub_ptr_;
 
@@ -154,7 +168,7 @@ public:
       node, "lanelet/marker", LaneletMarkerQoS(),
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     hdmap_utils_ptr_(std::make_shared<hdmap_utils::HdMapUtils>(
-      configuration.lanelet2_map_path(), getOrigin(*node))),
+      configuration.lanelet2_map_path(), getOrigin(*node), configuration.route_cache_capacity)),
     markers_raw_(hdmap_utils_ptr_->generateMarker()),
     traffic_light_manager_ptr_(makeTrafficLightManager(hdmap_utils_ptr_, node))
   {
@@ -170,6 +184,11 @@ public:
     return traffic_light_manager_ptr_->getTrafficLight(std::forward<decltype(xs)>(xs)...);
   }
 
+  auto getChangedTrafficLightIds() const -> decltype(auto)
+  {
+    return traffic_light_manager_ptr_->getChangedTrafficLightIds();
+  }
+
   auto getTrafficLights() const -> decltype(auto)
   {
     return traffic_light_manager_ptr_->getTrafficLights();
@@ -266,6 +285,9 @@ public:
   void broadcastTransform(
     const geometry_msgs::msg::PoseStamped & pose, const bool static_transform = true);
 
+  static auto toTransformStamped(const geometry_msgs::msg::PoseStamped & pose)
+    -> geometry_msgs::msg::TransformStamped;
+
   bool checkCollision(const std::string & name0, const std::string & name1);
 
   bool despawnEntity(const std::string & name);
@@ -369,6 +391,8 @@ public:
   auto setEntityStatus(const std::string & name, const traffic_simulator_msgs::msg::EntityStatus &)
     -> void;
 
+  void reset();
+
   void setVerbose(const bool verbose);
 
   template <typename Entity, typename Pose, typename Parameters, typename... Ts>
@@ -457,6 +481,10 @@ public:
 
   void update(const double current_time, const double step_time);
 
+  void publishEntityStatusArray(
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & all_status,
+    const double time);
+
   void updateHdmapMarker();
 
   void startNpcLogic();
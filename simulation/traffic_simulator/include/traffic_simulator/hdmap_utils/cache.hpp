@@ -15,51 +15,135 @@
 #ifndef TRAFFIC_SIMULATOR__HDMAP_UTILS__CACHE_HPP_
 #define TRAFFIC_SIMULATOR__HDMAP_UTILS__CACHE_HPP_
 
+#include <algorithm>
 #include <boost/optional.hpp>
+#include <cstdint>
+#include <functional>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <memory>
 #include <mutex>
+#include <scenario_simulator_cache/least_recently_used_cache.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace hdmap_utils
 {
+using common::CacheStatistics;
+using common::LeastRecentlyUsedCache;
+
+/*
+   The routes are stored back to back in a single arena instead of one vector
+   per route, and each entry only holds the range of its route in the arena.
+   The ranges of evicted routes are reclaimed by compacting the arena once they
+   take up more than half of it.
+*/
 class RouteCache
 {
 public:
-  bool exists(std::int64_t from, std::int64_t to)
+  explicit RouteCache(std::size_t capacity) : data_(capacity) {}
+  bool exists(std::int64_t from, std::int64_t to) { return find(from, to) != boost::none; }
+  boost::optional<std::vector<std::int64_t>> find(std::int64_t from, std::int64_t to)
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    std::pair<std::int64_t, std::int64_t> key;
-    key.first = from;
-    key.second = to;
-    if (data_.find(key) == data_.end()) {
-      return false;
+    if (const auto range = data_.find({from, to})) {
+      return std::vector<std::int64_t>(
+        arena_.begin() + range->first, arena_.begin() + range->first + range->second);
+    } else {
+      return boost::none;
     }
-    return true;
   }
   std::vector<std::int64_t> getRoute(std::int64_t from, std::int64_t to)
   {
-    if (!exists(from, to)) {
+    if (const auto route = find(from, to)) {
+      return route.get();
+    } else {
       THROW_SIMULATION_ERROR(
         "route from : ", from, " to : ", to, " does not exists on route cache.");
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    const auto ret = data_.at({from, to});
-    return ret;
   }
   void appendData(std::int64_t from, std::int64_t to, const std::vector<std::int64_t> & route)
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    data_[{from, to}] = route;
+    const Range range(arena_.size(), route.size());
+    arena_.insert(arena_.end(), route.begin(), route.end());
+    if (const auto released = data_.insert({from, to}, range)) {
+      garbage_ += released->second;
+    }
+    if (arena_.size() < 2 * garbage_) {
+      compact();
+    }
   }
+  CacheStatistics getStatistics() { return data_.getStatistics(); }
 
 private:
-  std::unordered_map<std::pair<std::int64_t, std::int64_t>, std::vector<std::int64_t>> data_;
+  using Key = std::pair<std::int64_t, std::int64_t>;
+  struct KeyHash
+  {
+    std::size_t operator()(const Key & key) const
+    {
+      return std::hash<std::int64_t>()(key.first) * 31 + std::hash<std::int64_t>()(key.second);
+    }
+  };
+  using Range = std::pair<std::size_t, std::size_t>;  // offset and size in the arena
+  void compact()
+  {
+    std::vector<std::int64_t> arena;
+    arena.reserve(arena_.size() - garbage_);
+    data_.forEach([&](Range & range) {
+      const auto offset = arena.size();
+      arena.insert(
+        arena.end(), arena_.begin() + range.first, arena_.begin() + range.first + range.second);
+      range.first = offset;
+    });
+    arena_ = std::move(arena);
+    garbage_ = 0;
+  }
+  LeastRecentlyUsedCache<Key, Range, KeyHash> data_;
+  std::vector<std::int64_t> arena_;
+  std::size_t garbage_ = 0;
   std::mutex mutex_;
 };
 
+/*
+   Shortest distances along the lanelets (without lane changes) from the end of
+   one lanelet to the start of each lanelet within the horizon. If complete is
+   true, the search was not cut off by the horizon, so a lanelet missing from
+   distances is not reachable at all.
+*/
+struct LongitudinalDistances
+{
+  double horizon;
+  bool complete;
+  std::unordered_map<std::int64_t, double> distances;
+};
+
+class LongitudinalDistancesCache
+{
+public:
+  explicit LongitudinalDistancesCache(std::size_t capacity = 256) : data_(capacity) {}
+  std::shared_ptr<const LongitudinalDistances> find(std::int64_t lanelet_id, double horizon)
+  {
+    if (const auto cached = data_.find(lanelet_id);
+        cached and (cached.get()->complete or horizon <= cached.get()->horizon)) {
+      return cached.get();
+    } else {
+      return nullptr;
+    }
+  }
+  void appendData(
+    std::int64_t lanelet_id, const std::shared_ptr<const LongitudinalDistances> & distances)
+  {
+    data_.insert(lanelet_id, distances);
+  }
+  CacheStatistics getStatistics() { return data_.getStatistics(); }
+
+private:
+  LeastRecentlyUsedCache<std::int64_t, std::shared_ptr<const LongitudinalDistances>> data_;
+};
+
 class CenterPointsCache
 {
 public:
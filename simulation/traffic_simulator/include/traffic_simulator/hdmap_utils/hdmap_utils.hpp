@@ -64,7 +64,9 @@ enum class LaneletType { LANE, CROSSWALK };
 class HdMapUtils
 {
 public:
-  explicit HdMapUtils(const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &);
+  explicit HdMapUtils(
+    const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &,
+    std::size_t route_cache_capacity = 4096);
 
   const autoware_auto_mapping_msgs::msg::HADMapBin toMapBin();
   void insertMarkerArray(
@@ -112,6 +114,8 @@ public:
     traffic_simulator_msgs::msg::LaneletPose from, traffic_simulator_msgs::msg::LaneletPose to);
   boost::optional<double> getLongitudinalDistance(
     std::int64_t from_lanelet_id, double from_s, std::int64_t to_lanelet_id, double to_s);
+  std::unordered_map<std::int64_t, double> getLongitudinalDistances(
+    const traffic_simulator_msgs::msg::LaneletPose & from, double horizon);
   double getSpeedLimit(std::vector<std::int64_t> lanelet_ids);
   bool isInRoute(std::int64_t lanelet_id, std::vector<std::int64_t> route) const;
   std::vector<std::int64_t> getFollowingLanelets(
@@ -137,6 +141,8 @@ public:
     double forward_distance_threshold);
   boost::optional<geometry_msgs::msg::Vector3> getTangentVector(std::int64_t lanelet_id, double s);
   std::vector<std::int64_t> getRoute(std::int64_t from_lanelet_id, std::int64_t to_lanelet_id);
+  auto getRouteCacheStatistics() -> CacheStatistics;
+  auto getLongitudinalDistancesCacheStatistics() -> CacheStatistics;
   std::vector<std::int64_t> getConflictingCrosswalkIds(
     const std::vector<std::int64_t> & lanelet_ids) const;
   std::vector<std::int64_t> getConflictingLaneIds(
@@ -195,7 +201,10 @@ private:
     const traffic_simulator_msgs::msg::LaneletPose & to_pose,
     const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
     double tangent_vector_size = 100);
+  std::shared_ptr<const LongitudinalDistances> getLongitudinalDistancesFromEndOf(
+    std::int64_t lanelet_id, double horizon);
   RouteCache route_cache_;
+  LongitudinalDistancesCache longitudinal_distances_cache_;
   CenterPointsCache center_points_cache_;
   LaneletLengthCache lanelet_length_cache_;
   std::vector<lanelet::AutowareTrafficLightConstPtr> getTrafficLights(
@@ -211,6 +220,13 @@ private:
   std::vector<lanelet::ConstLineString3d> getStopLinesOnPath(std::vector<std::int64_t> lanelet_ids);
   geometry_msgs::msg::Vector3 getVectorFromPose(geometry_msgs::msg::Pose pose, double magnitude);
   void mapCallback(const autoware_auto_mapping_msgs::msg::HADMapBin & msg);
+  bool loadMapArtifact(
+    const boost::filesystem::path & map_artifact_path, const std::string & map_hash);
+  void saveMapArtifact(
+    const boost::filesystem::path & map_artifact_path, const std::string & map_hash) const;
+  const visualization_msgs::msg::MarkerArray generateMarkerArray() const;
+  autoware_auto_mapping_msgs::msg::HADMapBin map_bin_;
+  visualization_msgs::msg::MarkerArray markers_;
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::routing::RoutingGraphConstPtr vehicle_routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_vehicle_ptr_;
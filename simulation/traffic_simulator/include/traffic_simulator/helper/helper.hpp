@@ -97,7 +97,8 @@ const simulation_api_schema::LidarConfiguration constructLidarConfiguration(
 
 const simulation_api_schema::DetectionSensorConfiguration constructDetectionSensorConfiguration(
   const std::string & entity, const std::string & architecture_type, const double update_duration,
-  const double range = 300.0, bool filter_by_range = false);
+  const double range = 300.0, bool filter_by_range = false, bool filter_by_occlusion = false,
+  const double minimum_visible_ratio = 0.0);
 }  // namespace helper
 }  // namespace traffic_simulator
 
@@ -15,8 +15,11 @@
 #ifndef TRAFFIC_SIMULATOR__JOB__JOB_LIST_HPP_
 #define TRAFFIC_SIMULATOR__JOB__JOB_LIST_HPP_
 
+#include <cstddef>
+#include <iostream>
+#include <list>
 #include <traffic_simulator/job/job.hpp>
-#include <vector>
+#include <unordered_map>
 
 namespace traffic_simulator
 {
@@ -25,15 +28,33 @@ namespace job
 class JobList
 {
 public:
+  struct Statistics
+  {
+    std::size_t active = 0;
+    std::size_t finished = 0;   // NOTE: func_on_update returned true.
+    std::size_t cancelled = 0;  // NOTE: Inactivated by an exclusive job appended later.
+  };
+
   void append(
     const std::function<bool(const double)> & func_on_update,
     const std::function<void()> & func_on_cleanup, job::Type type, bool exclusive,
     const job::Event event);
   void update(const double step_time, const job::Event event);
+  Statistics getStatistics() const;
 
 private:
-  std::vector<Job> list_;
+  /*
+     Only active jobs are held, and they are removed as soon as they become
+     inactive, so that both append and update are proportional to the number
+     of active jobs rather than to the number of jobs ever appended. Jobs are
+     kept in the order they were appended for each event.
+  */
+  std::unordered_map<job::Event, std::list<Job>> list_;
+  std::size_t finished_ = 0;
+  std::size_t cancelled_ = 0;
 };
+
+std::ostream & operator<<(std::ostream & os, const JobList::Statistics & statistics);
 }  // namespace job
 }  // namespace traffic_simulator
 
@@ -50,6 +50,8 @@ public:
 
   void calculate();
 
+  void reset();
+
   const boost::filesystem::path log_path;
 
   const bool write_file_every_frame;
@@ -246,6 +246,11 @@ struct TrafficLight
       return lhs.hash() < rhs.hash();
     }
 
+    friend constexpr auto operator==(const Bulb & lhs, const Bulb & rhs) -> bool
+    {
+      return lhs.hash() == rhs.hash();
+    }
+
     friend auto operator<<(std::ostream & os, const Bulb & bulb) -> std::ostream &;
 
     explicit operator autoware_auto_perception_msgs::msg::TrafficLight() const;
@@ -255,12 +260,23 @@ struct TrafficLight
 
   std::set<Bulb> bulbs;
 
+  /*
+     The bulbs as of the last commit. Changes are told by comparing against
+     them instead of flagging each modification, so that clearing and setting
+     the same state again (as TrafficSignalStateAction does) is not a change.
+  */
+  std::set<Bulb> committed_bulbs;
+
   const std::map<Bulb::Hash, boost::optional<geometry_msgs::msg::Point>> positions;
 
   explicit TrafficLight(const std::int64_t, hdmap_utils::HdMapUtils &);
 
+  auto changed() const { return bulbs != committed_bulbs; }
+
   auto clear() { bulbs.clear(); }
 
+  auto commit() { committed_bulbs = bulbs; }
+
   auto contains(const Bulb & bulb) const { return bulbs.find(bulb) != std::end(bulbs); }
 
   auto contains(const Color & color, const Status & status, const Shape & shape) const
@@ -38,6 +38,8 @@ protected:
 
   std::unordered_map<LaneletID, TrafficLight> traffic_lights_;
 
+  std::vector<LaneletID> changed_traffic_light_ids_;  // NOTE: Found by the last update.
+
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr marker_pub_;
 
   const rclcpp::Clock::SharedPtr clock_ptr_;
@@ -77,6 +79,8 @@ public:
     }
   }
 
+  auto getChangedTrafficLightIds() const -> const auto & { return changed_traffic_light_ids_; }
+
   auto getTrafficLights() const -> const auto & { return traffic_lights_; }
 
   auto getTrafficLights() -> auto & { return traffic_lights_; }
@@ -103,6 +107,8 @@ public:
 
   auto hasAnyLightChanged() -> bool;
 
+  auto reset() -> void;
+
   auto update(const double) -> void;
 };
 
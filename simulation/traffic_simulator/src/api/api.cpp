@@ -14,6 +14,7 @@
 
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <frame_profiler/frame_profiler.hpp>
 #include <limits>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -31,6 +32,8 @@ metrics::MetricLifecycle API::getMetricLifecycle(const std::string & name)
 
 bool API::metricExists(const std::string & name) { return metrics_manager_.exists(name); }
 
+API::~API() { frame_profiler::Profiler::stopTrace(); }
+
 void API::setVerbose(const bool verbose)
 {
   metrics_manager_.setVerbose(verbose);
@@ -261,6 +264,7 @@ bool API::updateSensorFrame()
     simulation_interface::toProto(
       clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
     simulation_api_schema::UpdateSensorFrameResponse res;
+    frame_profiler::Zone zone("zeromq::MultiClient::call(UpdateSensorFrameRequest)");
     zeromq_client_.call(req, res);
     return res.result().success();
   }
@@ -271,13 +275,19 @@ bool API::updateTrafficLightsInSim()
   simulation_api_schema::UpdateTrafficLightsRequest req;
   simulation_api_schema::UpdateTrafficLightsResponse res;
   if (entity_manager_ptr_->trafficLightsChanged()) {
-    for (const auto & [id, traffic_light] : entity_manager_ptr_->getTrafficLights()) {
+    // NOTE: Only the traffic lights changed in this frame are sent.
+    for (const auto & id : entity_manager_ptr_->getChangedTrafficLightIds()) {
       simulation_api_schema::TrafficLightState state;
       simulation_interface::toProto(
-        static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(traffic_light), state);
+        static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(
+          entity_manager_ptr_->getTrafficLights().at(id)),
+        state);
       *req.add_states() = state;
     }
+    frame_profiler::Zone zone("zeromq::MultiClient::call(UpdateTrafficLightsRequest)");
     zeromq_client_.call(req, res);
+  } else {
+    res.mutable_result()->set_success(true);
   }
   // TODO handle response
   return res.result().success();
@@ -303,7 +313,10 @@ bool API::updateEntityStatusInSim()
     *req.add_status() = proto;
   }
   simulation_api_schema::UpdateEntityStatusResponse res;
-  zeromq_client_.call(req, res);
+  {
+    frame_profiler::Zone zone("zeromq::MultiClient::call(UpdateEntityStatusRequest)");
+    zeromq_client_.call(req, res);
+  }
   for (const auto & status : res.status()) {
     traffic_simulator_msgs::msg::EntityStatus status_msg;
     status_msg = entity_manager_ptr_->getEntityStatus(status.name());
@@ -326,8 +339,15 @@ bool API::updateEntityStatusInSim()
   return res.result().success();
 }
 
+void API::reset()
+{
+  entity_manager_ptr_->reset();
+  metrics_manager_.reset();
+}
+
 bool API::updateFrame()
 {
+  frame_profiler::Zone zone("API::updateFrame");
   boost::optional<traffic_simulator_msgs::msg::EntityStatus> ego_status_before_update = boost::none;
   entity_manager_ptr_->update(clock_.getCurrentSimulationTime(), clock_.getStepTime());
   traffic_controller_ptr_->execute();
@@ -338,7 +358,10 @@ bool API::updateFrame()
     simulation_interface::toProto(
       clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
     simulation_api_schema::UpdateFrameResponse res;
-    zeromq_client_.call(req, res);
+    {
+      frame_profiler::Zone zone("zeromq::MultiClient::call(UpdateFrameRequest)");
+      zeromq_client_.call(req, res);
+    }
     if (!res.result().success()) {
       return false;
     }
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <geometry/linear_algebra.hpp>
 #include <iostream>
 #include <rclcpp/rclcpp.hpp>
@@ -109,18 +110,118 @@ auto LongitudinalSpeedPlanner::getRunningDistance(
   constexpr double twist_tolerance = 0.01;
   if (isTargetSpeedReached(target_speed, current_twist, twist_tolerance)) {
     return 0;
+  } else if (const auto accelerating = isAccelerating(target_speed, current_twist);
+             0 < step_time and std::abs(target_speed) <= constraints.max_speed and
+             std::abs(current_twist.linear.x) <= constraints.max_speed and
+             0 < (accelerating ? constraints.max_acceleration : constraints.max_deceleration) and
+             0 < (accelerating ? constraints.max_acceleration_rate
+                               : constraints.max_deceleration_rate)) {
+    return getRunningDistanceWithPiecewiseConstantJerk(
+      target_speed, constraints, current_twist, current_accel, twist_tolerance);
+  } else {
+    double ret = 0;
+    std::tuple<geometry_msgs::msg::Twist, geometry_msgs::msg::Accel, double> next_state =
+      std::make_tuple(current_twist, current_accel, current_linear_jerk);
+    do {
+      next_state = getDynamicStates(
+        target_speed, constraints, std::get<0>(next_state), std::get<1>(next_state));
+      ret = ret + std::get<0>(next_state).linear.x * step_time +
+            std::get<1>(next_state).linear.x * step_time * step_time / 2.0 +
+            std::get<2>(next_state) * step_time * step_time * step_time / 6.0;
+    } while (!isTargetSpeedReached(target_speed, std::get<0>(next_state), twist_tolerance));
+    return ret;
   }
-  double ret = 0;
-  std::tuple<geometry_msgs::msg::Twist, geometry_msgs::msg::Accel, double> next_state =
-    std::make_tuple(current_twist, current_accel, current_linear_jerk);
-  do {
-    next_state =
-      getDynamicStates(target_speed, constraints, std::get<0>(next_state), std::get<1>(next_state));
-    ret = ret + std::get<0>(next_state).linear.x * step_time +
-          std::get<1>(next_state).linear.x * step_time * step_time / 2.0 +
-          std::get<2>(next_state) * step_time * step_time * step_time / 6.0;
-  } while (!isTargetSpeedReached(target_speed, std::get<0>(next_state), twist_tolerance));
-  return ret;
+}
+
+auto LongitudinalSpeedPlanner::getRunningDistanceWithPiecewiseConstantJerk(
+  double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
+  const geometry_msgs::msg::Twist & current_twist, const geometry_msgs::msg::Accel & current_accel,
+  double tolerance) const -> double
+{
+  /*
+     Closed form of the distance getRunningDistance would accumulate by
+     stepping getDynamicStates until the target speed is reached.
+
+     The n-th step of getDynamicStates moves v[n-1] to v[n] with the
+     acceleration a[n] = (v[n] - v[n-1]) / dt and the jerk
+     (a[n] - a[n-1]) / dt, and the distance of the step is
+     v[n] dt + a[n] dt^2 / 2 + (a[n] - a[n-1]) dt^2 / 6. Because both the
+     acceleration and the jerk terms telescope, the distance of n steps is
+
+       dt (v[1] + ... + v[n]) + dt (v[n] - v[0]) / 2 + dt^2 (a[n] - a[0]) / 6
+
+     so only the sum of the velocities has to be known. After the first step,
+     the acceleration ramps up by rate * dt per step until it reaches its
+     maximum and then stays there, so the velocities are a quadratic and then
+     a linear sequence whose sums and crossing of the target speed are
+     solved directly. The last step reaches exactly the target speed.
+
+     Deceleration is the mirror image of acceleration, so the speeds are
+     flipped in sign to reuse the same solution.
+  */
+  const auto sign = isAccelerating(target_speed, current_twist) ? 1.0 : -1.0;
+  const auto rate =
+    sign < 0 ? constraints.max_deceleration_rate : constraints.max_acceleration_rate;
+  const auto maximum = sign < 0 ? constraints.max_deceleration : constraints.max_acceleration;
+  const auto dt = step_time;
+  const auto target = sign * target_speed;
+  const auto threshold = target - tolerance;
+
+  const auto v0 = sign * current_twist.linear.x;
+  const auto a0 = sign * current_accel.linear.x;
+  const auto a1 = std::clamp(a0 + dt * rate, 0.0, std::min(maximum, (target - v0) / dt));
+  const auto v1 = v0 + a1 * dt;
+
+  // NOTE: v[1 + i] while the acceleration is ramping up, and its sum over 1 <= i <= n.
+  auto ramp_velocity = [&](double i) { return v1 + dt * (i * a1 + rate * dt * i * (i + 1) / 2); };
+  auto ramp_velocity_sum = [&](double n) {
+    return n * v1 + dt * (a1 * n * (n + 1) / 2 + rate * dt * n * (n + 1) * (n + 2) / 6);
+  };
+
+  // NOTE: The smallest i >= 1 such that velocity(i) >= threshold, given an approximation of it.
+  auto first_reaching = [&](auto velocity, double i) {
+    i = std::max(std::ceil(i), 1.0);
+    while (1 < i and threshold <= velocity(i - 1)) {
+      --i;
+    }
+    while (velocity(i) < threshold) {
+      ++i;
+    }
+    return i;
+  };
+
+  const auto first_step_distance = v1 * dt + a1 * dt * dt / 2 + (a1 - a0) * dt * dt / 6;
+
+  if (threshold <= v1) {
+    return sign * first_step_distance;
+  }
+
+  double velocity_sum = 0;  // v[2] + ... + v[n - 1]
+  double previous_velocity = 0;  // v[n - 1]
+  double unbounded_velocity = 0;  // v[n] if the last step were not bounded by the target speed
+
+  if (const auto ramp_length = std::max(std::ceil((maximum - a1) / (rate * dt)) - 1, 0.0);
+      threshold <= ramp_velocity(ramp_length)) {
+    const auto a = rate * dt * dt / 2;
+    const auto b = a1 * dt + a;
+    const auto n = first_reaching(
+      ramp_velocity, (-b + std::sqrt(b * b + 4 * a * (threshold - v1))) / (2 * a));
+    velocity_sum = ramp_velocity_sum(n - 1);
+    previous_velocity = ramp_velocity(n - 1);
+    unbounded_velocity = ramp_velocity(n);
+  } else {
+    const auto v = ramp_velocity(ramp_length);
+    auto linear_velocity = [&](double i) { return v + i * maximum * dt; };
+    const auto n = first_reaching(linear_velocity, (threshold - v) / (maximum * dt));
+    velocity_sum = ramp_velocity_sum(ramp_length) + (n - 1) * v + maximum * dt * (n - 1) * n / 2;
+    previous_velocity = linear_velocity(n - 1);
+    unbounded_velocity = linear_velocity(n);
+  }
+
+  const auto vn = std::min(unbounded_velocity, target);
+  const auto an = (vn - previous_velocity) / dt;
+  return sign * (first_step_distance + dt * (velocity_sum + vn) + dt * (vn - v1) / 2 +
+                 dt * dt * (an - a1) / 6);
 }
 
 auto LongitudinalSpeedPlanner::isTargetSpeedReached(
@@ -199,6 +199,11 @@ auto EntityBase::getEntityStatusBeforeUpdate() const
   return status_before_update_;
 }
 
+auto EntityBase::getJobStatistics() const -> job::JobList::Statistics
+{
+  return job_list_.getStatistics();
+}
+
 auto EntityBase::getLinearJerk() const -> double { return getStatus().action_status.linear_jerk; }
 
 auto EntityBase::getLaneletPose() const -> boost::optional<traffic_simulator_msgs::msg::LaneletPose>
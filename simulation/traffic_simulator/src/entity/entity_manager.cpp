@@ -12,9 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <cstdint>
+#include <frame_profiler/frame_profiler.hpp>
 #include <geometry/bounding_box.hpp>
 #include <geometry/intersection/collision.hpp>
+#include <geometry/polygon/polygon.hpp>
 #include <geometry/transform.hpp>
 #include <limits>
 #include <memory>
@@ -35,18 +38,37 @@ namespace entity
 {
 void EntityManager::broadcastEntityTransform()
 {
-  std::vector<std::string> names = getEntityNames();
-  for (const auto & name : names) {
-    geometry_msgs::msg::PoseStamped pose;
-    pose.pose = getEntityStatus(name).pose;
-    pose.header.stamp = clock_ptr_->now();
-    pose.header.frame_id = name;
-    broadcastTransform(pose);
+  frame_profiler::Zone zone("EntityManager::broadcastEntityTransform");
+
+  /*
+     All transforms of a frame are sent at once with the same timestamp. A
+     StaticTransformBroadcaster publishes every transform it has ever been
+     given on each call, so sending them one by one used to publish O(N^2)
+     transforms per frame.
+  */
+  geometry_msgs::msg::PoseStamped pose;
+  pose.header.stamp = clock_ptr_->now();
+
+  std::vector<geometry_msgs::msg::TransformStamped> transforms;
+  transforms.reserve(entities_.size());
+
+  for (const auto & [name, entity] : entities_) {
+    if (
+      configuration.broadcast_npc_tf or
+      entity->getStatus().type.type == traffic_simulator_msgs::msg::EntityType::EGO) {
+      pose.header.frame_id = name;
+      pose.pose = entity->getStatus().pose;
+      transforms.push_back(toTransformStamped(pose));
+    }
+  }
+
+  if (not transforms.empty()) {
+    broadcaster_.sendTransform(transforms);
   }
 }
 
-void EntityManager::broadcastTransform(
-  const geometry_msgs::msg::PoseStamped & pose, const bool static_transform)
+auto EntityManager::toTransformStamped(const geometry_msgs::msg::PoseStamped & pose)
+  -> geometry_msgs::msg::TransformStamped
 {
   geometry_msgs::msg::TransformStamped transform_stamped;
   {
@@ -58,11 +80,16 @@ void EntityManager::broadcastTransform(
     transform_stamped.transform.translation.z = pose.pose.position.z;
     transform_stamped.transform.rotation = pose.pose.orientation;
   }
+  return transform_stamped;
+}
 
+void EntityManager::broadcastTransform(
+  const geometry_msgs::msg::PoseStamped & pose, const bool static_transform)
+{
   if (static_transform) {
-    broadcaster_.sendTransform(transform_stamped);
+    broadcaster_.sendTransform(toTransformStamped(pose));
   } else {
-    base_link_broadcaster_.sendTransform(transform_stamped);
+    base_link_broadcaster_.sendTransform(toTransformStamped(pose));
   }
 }
 
@@ -474,6 +501,14 @@ auto EntityManager::setEntityStatus(
   }
 }
 
+void EntityManager::reset()
+{
+  entities_.clear();
+  traffic_light_manager_ptr_->reset();
+  current_time_ = std::numeric_limits<double>::quiet_NaN();
+  npc_logic_started_ = false;
+}
+
 void EntityManager::setVerbose(const bool verbose)
 {
   configuration.verbose = verbose;
@@ -492,16 +527,21 @@ traffic_simulator_msgs::msg::EntityStatus EntityManager::updateNpcLogic(
   const std::string & name,
   const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
 {
+  frame_profiler::Zone zone("EntityManager::updateNpcLogic");
   if (configuration.verbose) {
     std::cout << "update " << name << " behavior" << std::endl;
   }
   entities_[name]->setEntityTypeList(type_list);
   entities_[name]->onUpdate(current_time_, step_time_);
+  if (configuration.verbose) {
+    std::cout << "jobs of " << name << ": " << entities_[name]->getJobStatistics() << std::endl;
+  }
   return entities_[name]->getStatus();
 }
 
 void EntityManager::update(const double current_time, const double step_time)
 {
+  frame_profiler::Zone zone("EntityManager::update");
   traffic_simulator::helper::StopWatch<std::chrono::milliseconds> stop_watch_update(
     "EntityManager::update", configuration.verbose);
   step_time_ = step_time;
@@ -525,13 +565,96 @@ void EntityManager::update(const double current_time, const double step_time)
   for (auto && [name, entity] : entities_) {
     entity->setOtherStatus(all_status);
   }
+  publishEntityStatusArray(all_status, current_time + step_time);
+  stop_watch_update.stop();
+  if (configuration.verbose) {
+    stop_watch_update.print();
+    std::cout << "RouteCache: " << hdmap_utils_ptr_->getRouteCacheStatistics() << std::endl;
+    std::cout << "LongitudinalDistancesCache: "
+              << hdmap_utils_ptr_->getLongitudinalDistancesCacheStatistics() << std::endl;
+  }
+}
+
+void EntityManager::publishEntityStatusArray(
+  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & all_status,
+  const double time)
+{
+  frame_profiler::Zone zone("EntityManager::publishEntityStatusArray");
+
+  /*
+     The message is only for visualization, so its rate is limited by the wall
+     clock rather than following the simulation rate, and nothing is built at
+     all while nobody subscribes.
+  */
+  const auto now = std::chrono::steady_clock::now();
+
+  if (
+    0 < configuration.entity_status_rate and
+    now - entity_status_array_published_time_ <
+      std::chrono::duration<double>(1 / configuration.entity_status_rate)) {
+    return;
+  }
+
+  const auto subscription_count = entity_status_array_pub_ptr_->get_subscription_count();
+
+  if (entity_status_array_subscription_count_ < subscription_count) {
+    published_trajectories_.clear();  // NOTE: A new subscriber has not seen any trajectory yet.
+  }
+
+  entity_status_array_subscription_count_ = subscription_count;
+
+  if (subscription_count == 0) {
+    return;
+  }
+
+  entity_status_array_published_time_ = now;
+
+  /*
+     Every trajectory_keyframe_interval messages is a keyframe carrying the
+     trajectories of all the entities even if they have not changed, so that a
+     subscriber that missed a message (or joined without being counted above
+     yet) recovers within that many messages.
+  */
+  constexpr std::size_t trajectory_keyframe_interval = 20;
+
+  if (entity_status_array_publish_count_++ % trajectory_keyframe_interval == 0) {
+    published_trajectories_.clear();
+  } else {
+    for (auto iter = std::begin(published_trajectories_);
+         iter != std::end(published_trajectories_);) {
+      iter = all_status.count(iter->first) ? std::next(iter) : published_trajectories_.erase(iter);
+    }
+  }
+
   traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
+  status_array_msg.data.reserve(all_status.size());
   for (auto && [name, status] : all_status) {
     traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_trajectory;
     status_with_trajectory.waypoint = getWaypoints(name);
+    if (const auto & waypoints = status_with_trajectory.waypoint.waypoints;
+        0 < configuration.waypoint_tolerance and 2 < waypoints.size()) {
+      auto simplified =
+        math::geometry::simplifyPolyline(waypoints, configuration.waypoint_tolerance);
+      if (simplified.size() < 3) {
+        // NOTE: The CatmullRomSpline drawn from the waypoints needs at least 3 points.
+        simplified.insert(std::next(std::begin(simplified)), waypoints[waypoints.size() / 2]);
+      }
+      status_with_trajectory.waypoint.waypoints = std::move(simplified);
+    }
     for (const auto & goal : getGoalPoses<geometry_msgs::msg::Pose>(name)) {
       status_with_trajectory.goal_pose.push_back(goal);
     }
+    if (const auto iter = published_trajectories_.find(name);
+        iter != std::end(published_trajectories_) and
+        iter->second.waypoint == status_with_trajectory.waypoint and
+        iter->second.goal_pose == status_with_trajectory.goal_pose) {
+      status_with_trajectory.waypoint.waypoints.clear();
+      status_with_trajectory.goal_pose.clear();
+      status_with_trajectory.trajectory_updated = false;
+    } else {
+      published_trajectories_[name] = status_with_trajectory;
+      status_with_trajectory.trajectory_updated = true;
+    }
     if (const auto obstacle = getObstacle(name); obstacle) {
       status_with_trajectory.obstacle = obstacle.get();
       status_with_trajectory.obstacle_find = true;
@@ -540,14 +663,10 @@ void EntityManager::update(const double current_time, const double step_time)
     }
     status_with_trajectory.status = status;
     status_with_trajectory.name = name;
-    status_with_trajectory.time = current_time + step_time;
-    status_array_msg.data.emplace_back(status_with_trajectory);
+    status_with_trajectory.time = time;
+    status_array_msg.data.emplace_back(std::move(status_with_trajectory));
   }
   entity_status_array_pub_ptr_->publish(status_array_msg);
-  stop_watch_update.stop();
-  if (configuration.verbose) {
-    stop_watch_update.print();
-  }
 }
 
 void EntityManager::updateHdmapMarker()
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <unistd.h>
+
 #include <lanelet2_core/utility/Units.h>
 #include <lanelet2_io/Io.h>
 #include <lanelet2_io/io_handlers/Serialize.h>
@@ -26,11 +28,19 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cmath>
+#include <cstdint>
 #include <deque>
+#include <frame_profiler/frame_profiler.hpp>
+#include <functional>
+#include <fstream>
 #include <geometry/linear_algebra.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry/spline/hermite_curve.hpp>
 #include <geometry/transform.hpp>
+#include <iterator>
 #include <lanelet2_extension/io/autoware_osm_parser.hpp>
 #include <lanelet2_extension/projection/mgrs_projector.hpp>
 #include <lanelet2_extension/utility/message_conversion.hpp>
@@ -38,37 +48,81 @@
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <lanelet2_extension/visualization/visualization.hpp>
 #include <memory>
+#include <queue>
+#include <rclcpp/logging.hpp>
+#include <rclcpp/serialization.hpp>
+#include <scenario_simulator_cache/fnv1a.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
 #include <string>
 #include <traffic_simulator/color_utils/color_utils.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace hdmap_utils
 {
-HdMapUtils::HdMapUtils(
-  const boost::filesystem::path & lanelet2_map_path, const geographic_msgs::msg::GeoPoint &)
-{
-  lanelet::projection::MGRSProjector projector;
+/*
+   NOTE: Bump this whenever the content of the map artifact, or the processing
+   applied to the map before it is stored (e.g. the resolution of the
+   centerlines), changes. Artifacts of other versions are ignored.
+*/
+constexpr std::uint32_t map_artifact_version = 1;
 
-  lanelet::ErrorMessages errors;
+/*
+   NOTE: Horizon of the search behind getLongitudinalDistance. Targets farther
+   than this are rare (distance conditions and the behavior plugins look a few
+   hundred meters ahead at most), and are handled by the route instead.
+*/
+constexpr double longitudinal_distance_horizon = 1000.0;
 
-  lanelet_map_ptr_ = lanelet::load(lanelet2_map_path.string(), projector, &errors);
+auto mapArtifactPathOf(const std::string & map_hash) -> boost::filesystem::path
+{
+  return boost::filesystem::temp_directory_path() / "traffic_simulator" / (map_hash + ".map");
+}
 
-  if (not errors.empty()) {
-    std::stringstream ss;
-    const auto * separator = "";
-    for (const auto & error : errors) {
-      ss << separator << error;
-      separator = "\n";
+HdMapUtils::HdMapUtils(
+  const boost::filesystem::path & lanelet2_map_path, const geographic_msgs::msg::GeoPoint &,
+  std::size_t route_cache_capacity)
+: route_cache_(route_cache_capacity)
+{
+  /*
+     Parsing the OSM file, resampling every centerline and generating the
+     markers takes tens of seconds on a large map, and it used to be repeated
+     on every launch. The result is stored as a map artifact named after the
+     hash of the content of the OSM file, and is loaded instead as long as the
+     OSM file remains unchanged.
+  */
+  const auto map_hash = common::fnv1a(lanelet2_map_path);
+
+  const auto map_artifact_path = mapArtifactPathOf(map_hash);
+
+  if (not loadMapArtifact(map_artifact_path, map_hash)) {
+    lanelet::projection::MGRSProjector projector;
+
+    lanelet::ErrorMessages errors;
+
+    lanelet_map_ptr_ = lanelet::load(lanelet2_map_path.string(), projector, &errors);
+
+    if (not errors.empty()) {
+      std::stringstream ss;
+      const auto * separator = "";
+      for (const auto & error : errors) {
+        ss << separator << error;
+        separator = "\n";
+      }
+      THROW_SIMULATION_ERROR("Failed to load lanelet map (", ss.str(), ")");
     }
-    THROW_SIMULATION_ERROR("Failed to load lanelet map (", ss.str(), ")");
+    overwriteLaneletsCenterline();
+    lanelet::utils::conversion::toBinMsg(lanelet_map_ptr_, &map_bin_);
+    map_bin_.header.frame_id = "map";
+    markers_ = generateMarkerArray();
+    saveMapArtifact(map_artifact_path, map_hash);
   }
-  overwriteLaneletsCenterline();
+
   traffic_rules_vehicle_ptr_ = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
   vehicle_routing_graph_ptr_ =
@@ -357,6 +411,7 @@ boost::optional<std::int64_t> HdMapUtils::matchToLane(
   const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
   bool include_crosswalk, double reduction_ratio)
 {
+  frame_profiler::Zone zone("HdMapUtils::matchToLane");
   boost::optional<std::int64_t> id;
   lanelet::matching::Object2d obj;
   obj.pose.translation() = toPoint2d(pose.position);
@@ -466,6 +521,7 @@ boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletP
   geometry_msgs::msg::Pose pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
   bool include_crosswalk, double matching_distance)
 {
+  frame_profiler::Zone zone("HdMapUtils::toLaneletPose");
   const auto lanelet_id = matchToLane(pose, bbox, include_crosswalk);
   if (!lanelet_id) {
     return toLaneletPose(pose, include_crosswalk, matching_distance);
@@ -688,8 +744,9 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
 std::vector<std::int64_t> HdMapUtils::getRoute(
   std::int64_t from_lanelet_id, std::int64_t to_lanelet_id)
 {
-  if (route_cache_.exists(from_lanelet_id, to_lanelet_id)) {
-    return route_cache_.getRoute(from_lanelet_id, to_lanelet_id);
+  frame_profiler::Zone zone("HdMapUtils::getRoute");
+  if (const auto cached_route = route_cache_.find(from_lanelet_id, to_lanelet_id)) {
+    return cached_route.get();
   }
   std::vector<std::int64_t> ret;
   const auto lanelet = lanelet_map_ptr_->laneletLayer.get(from_lanelet_id);
@@ -712,6 +769,16 @@ std::vector<std::int64_t> HdMapUtils::getRoute(
   return ret;
 }
 
+auto HdMapUtils::getRouteCacheStatistics() -> CacheStatistics
+{
+  return route_cache_.getStatistics();
+}
+
+auto HdMapUtils::getLongitudinalDistancesCacheStatistics() -> CacheStatistics
+{
+  return longitudinal_distances_cache_.getStatistics();
+}
+
 std::shared_ptr<math::geometry::CatmullRomSpline> HdMapUtils::getCenterPointsSpline(
   std::int64_t lanelet_id)
 {
@@ -986,39 +1053,77 @@ HdMapUtils::getLaneChangeTrajectory(
   double maximum_curvature_threshold, double target_trajectory_length,
   double forward_distance_threshold)
 {
-  double to_length = getLaneletLength(lane_change_parameter.target.lanelet_id);
-  std::vector<double> evaluation, target_s;
-  std::vector<math::geometry::HermiteCurve> curves;
+  frame_profiler::Zone zone("HdMapUtils::getLaneChangeTrajectory");
+
+  const auto to_length = getLaneletLength(lane_change_parameter.target.lanelet_id);
 
-  for (double to_s = 0; to_s < to_length; to_s = to_s + 1.0) {
-    auto goal_pose = toMapPose(lane_change_parameter.target.lanelet_id, to_s, 0);
+  boost::optional<std::tuple<math::geometry::HermiteCurve, double, double>> best;
+
+  auto evaluate = [&](double to_s) {
+    const auto goal_pose = toMapPose(lane_change_parameter.target.lanelet_id, to_s, 0).pose;
     if (
-      math::geometry::getRelativePose(from_pose, goal_pose.pose).position.x <=
+      math::geometry::getRelativePose(from_pose, goal_pose).position.x <=
       forward_distance_threshold) {
-      continue;
+      return;
+    }
+    const auto start_to_goal_distance = std::hypot(
+      from_pose.position.x - goal_pose.position.x, from_pose.position.y - goal_pose.position.y,
+      from_pose.position.z - goal_pose.position.z);
+    /*
+       The length of a curve is never shorter than its chord, so a goal whose
+       chord alone is already farther from the target length than the best
+       candidate so far can be rejected without constructing the curve.
+    */
+    if (best and std::get<2>(*best) < start_to_goal_distance - target_trajectory_length) {
+      return;
     }
-    double start_to_goal_distance = std::sqrt(
-      std::pow(from_pose.position.x - goal_pose.pose.position.x, 2) +
-      std::pow(from_pose.position.y - goal_pose.pose.position.y, 2) +
-      std::pow(from_pose.position.z - goal_pose.pose.position.z, 2));
     traffic_simulator_msgs::msg::LaneletPose to_pose;
     to_pose.lanelet_id = lane_change_parameter.target.lanelet_id;
     to_pose.s = to_s;
-    auto traj = getLaneChangeTrajectory(
+    const auto curve = getLaneChangeTrajectory(
       from_pose, to_pose, lane_change_parameter.trajectory_shape, start_to_goal_distance * 0.5);
-    if (traj.getMaximum2DCurvature() < maximum_curvature_threshold) {
-      double eval = std::fabs(target_trajectory_length - traj.getLength());
-      evaluation.push_back(eval);
-      curves.push_back(traj);
-      target_s.push_back(to_s);
+    if (curve.getMaximum2DCurvature() < maximum_curvature_threshold) {
+      if (const auto evaluation = std::fabs(target_trajectory_length - curve.getLength());
+          not best or evaluation < std::get<2>(*best)) {
+        best.emplace(curve, to_s, evaluation);
+      }
+    }
+  };
+
+  /*
+     The length of the lane change trajectory grows with the distance to the
+     goal, so the evaluation is unimodal along the target lanelet in practice.
+     The goal is first searched every coarse_step meters, and then every
+     fine_step meters only around the best coarse one. When no coarse goal is
+     feasible (e.g. the target lanelet is shorter than coarse_step), every
+     fine_step meters of the target lanelet are searched instead.
+  */
+  constexpr double coarse_step = 8.0;
+  constexpr double fine_step = 1.0;
+
+  for (double to_s = 0; to_s < to_length; to_s += coarse_step) {
+    evaluate(to_s);
+  }
+
+  if (best) {
+    const auto coarse_s = std::get<1>(*best);
+    for (auto to_s = std::max(coarse_s - coarse_step + fine_step, 0.0);
+         to_s < std::min(coarse_s + coarse_step, to_length); to_s += fine_step) {
+      if (to_s != coarse_s) {
+        evaluate(to_s);
+      }
+    }
+  } else {
+    for (double to_s = 0; to_s < to_length; to_s += fine_step) {
+      evaluate(to_s);
     }
   }
-  if (evaluation.empty()) {
+
+  if (best) {
+    return std::make_pair(std::get<0>(*best), std::get<1>(*best));
+  } else {
     return boost::none;
   }
-  std::vector<double>::iterator min_itr = std::min_element(evaluation.begin(), evaluation.end());
-  size_t min_index = std::distance(evaluation.begin(), min_itr);
-  return std::make_pair(curves[min_index], target_s[min_index]);
 }
 
 math::geometry::HermiteCurve HdMapUtils::getLaneChangeTrajectory(
@@ -1034,8 +1139,8 @@ math::geometry::HermiteCurve HdMapUtils::getLaneChangeTrajectory(
   switch (trajectory_shape) {
     case traffic_simulator::lane_change::TrajectoryShape::CUBIC:
       start_vec = getVectorFromPose(from_pose, tangent_vector_size);
-      if (getTangentVector(to_pose.lanelet_id, to_pose.s)) {
-        to_vec = getTangentVector(to_pose.lanelet_id, to_pose.s).get();
+      if (const auto tangent_vector = getTangentVector(to_pose.lanelet_id, to_pose.s)) {
+        to_vec = tangent_vector.get();
       } else {
         THROW_SIMULATION_ERROR(
           "Failed to calculate tangent vector at lanelet_id : ", to_pose.lanelet_id,
@@ -1152,6 +1257,7 @@ boost::optional<double> HdMapUtils::getLongitudinalDistance(
 boost::optional<double> HdMapUtils::getLongitudinalDistance(
   std::int64_t from_lanelet_id, double from_s, std::int64_t to_lanelet_id, double to_s)
 {
+  frame_profiler::Zone zone("HdMapUtils::getLongitudinalDistance");
   if (from_lanelet_id == to_lanelet_id) {
     if (from_s > to_s) {
       return boost::none;
@@ -1159,6 +1265,19 @@ boost::optional<double> HdMapUtils::getLongitudinalDistance(
       return to_s - from_s;
     }
   }
+  const auto distances =
+    getLongitudinalDistancesFromEndOf(from_lanelet_id, longitudinal_distance_horizon);
+  if (const auto iter = distances->distances.find(to_lanelet_id);
+      iter != distances->distances.end()) {
+    return getLaneletLength(from_lanelet_id) - from_s + iter->second + to_s;
+  } else if (distances->complete) {
+    return boost::none;
+  }
+  /*
+     The target is farther than the horizon (or not reachable at all, which
+     cannot be told apart without searching the rest of the map), so fall back
+     to the route.
+  */
   const auto route = getRoute(from_lanelet_id, to_lanelet_id);
   if (route.empty()) {
     return boost::none;
@@ -1176,20 +1295,156 @@ boost::optional<double> HdMapUtils::getLongitudinalDistance(
   return distance;
 }
 
-const autoware_auto_mapping_msgs::msg::HADMapBin HdMapUtils::toMapBin()
+/*
+   Returns the longitudinal distance from the given pose to the start of each
+   lanelet whose start is within the horizon. Unlike calling
+   getLongitudinalDistance for each target, the whole neighbourhood is searched
+   only once.
+*/
+std::unordered_map<std::int64_t, double> HdMapUtils::getLongitudinalDistances(
+  const traffic_simulator_msgs::msg::LaneletPose & from, double horizon)
+{
+  std::unordered_map<std::int64_t, double> ret;
+  const auto offset = getLaneletLength(from.lanelet_id) - from.s;
+  if (offset <= horizon) {
+    const auto distances = getLongitudinalDistancesFromEndOf(from.lanelet_id, horizon - offset);
+    for (const auto & [lanelet_id, distance] : distances->distances) {
+      if (offset + distance <= horizon) {
+        ret.emplace(lanelet_id, offset + distance);
+      }
+    }
+  }
+  return ret;
+}
+
+/*
+   Dijkstra's algorithm over the following lanelets, stopped at the horizon.
+   Since the map never changes, the result only depends on the lanelet and is
+   kept for later frames and other entities starting from the same lanelet.
+*/
+std::shared_ptr<const LongitudinalDistances> HdMapUtils::getLongitudinalDistancesFromEndOf(
+  std::int64_t lanelet_id, double horizon)
+{
+  if (const auto cached = longitudinal_distances_cache_.find(lanelet_id, horizon)) {
+    return cached;
+  }
+  auto ret = std::make_shared<LongitudinalDistances>();
+  ret->horizon = horizon;
+  ret->complete = true;
+  using Candidate = std::pair<double, std::int64_t>;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+  for (const auto next_lanelet_id : getNextLaneletIds(lanelet_id)) {
+    candidates.emplace(0.0, next_lanelet_id);
+  }
+  while (not candidates.empty()) {
+    const auto [distance, candidate_id] = candidates.top();
+    candidates.pop();
+    if (horizon < distance) {
+      ret->complete = false;
+      break;
+    }
+    if (ret->distances.emplace(candidate_id, distance).second) {
+      const auto length = getLaneletLength(candidate_id);
+      for (const auto next_lanelet_id : getNextLaneletIds(candidate_id)) {
+        if (ret->distances.find(next_lanelet_id) == ret->distances.end()) {
+          candidates.emplace(distance + length, next_lanelet_id);
+        }
+      }
+    }
+  }
+  longitudinal_distances_cache_.appendData(lanelet_id, ret);
+  return ret;
+}
+
+const autoware_auto_mapping_msgs::msg::HADMapBin HdMapUtils::toMapBin() { return map_bin_; }
+
+/*
+   The map artifact consists of the serialized map (the same bytes as published
+   by toMapBin, from which the lanelets with resampled centerlines and their
+   spatial index are restored) and the serialized marker array. A missing,
+   stale or unreadable artifact is not an error; the caller falls back to
+   loading the OSM file.
+*/
+bool HdMapUtils::loadMapArtifact(
+  const boost::filesystem::path & map_artifact_path, const std::string & map_hash)
+{
+  try {
+    std::ifstream ifs(map_artifact_path.string(), std::ios::binary);
+    if (not ifs) {
+      return false;
+    }
+
+    boost::archive::binary_iarchive ia(ifs);
+
+    std::uint32_t version;
+    std::string hash;
+    ia >> version >> hash;
+    if (version != map_artifact_version or hash != map_hash) {
+      return false;
+    }
+
+    autoware_auto_mapping_msgs::msg::HADMapBin map_bin;
+    std::vector<std::uint8_t> marker_bytes;
+    ia >> map_bin.data >> marker_bytes;
+
+    auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(map_bin, lanelet_map_ptr);
+
+    rclcpp::SerializedMessage serialized_markers(marker_bytes.size());
+    auto & rcl_serialized_markers = serialized_markers.get_rcl_serialized_message();
+    std::copy(marker_bytes.begin(), marker_bytes.end(), rcl_serialized_markers.buffer);
+    rcl_serialized_markers.buffer_length = marker_bytes.size();
+    visualization_msgs::msg::MarkerArray markers;
+    rclcpp::Serialization<visualization_msgs::msg::MarkerArray>().deserialize_message(
+      &serialized_markers, &markers);
+
+    lanelet_map_ptr_ = lanelet_map_ptr;
+    map_bin_ = std::move(map_bin);
+    map_bin_.header.frame_id = "map";
+    markers_ = std::move(markers);
+    return true;
+  } catch (const std::exception &) {
+    return false;
+  }
+}
+
+void HdMapUtils::saveMapArtifact(
+  const boost::filesystem::path & map_artifact_path, const std::string & map_hash) const
 {
-  std::stringstream ss;
-  boost::archive::binary_oarchive oa(ss);
-  oa << *lanelet_map_ptr_;
-  auto id_counter = lanelet::utils::getId();
-  oa << id_counter;
-  std::string tmp_str = ss.str();
-  autoware_auto_mapping_msgs::msg::HADMapBin msg;
-  msg.data.clear();
-  msg.data.resize(tmp_str.size());
-  msg.data.assign(tmp_str.begin(), tmp_str.end());
-  msg.header.frame_id = "map";
-  return msg;
+  /*
+     NOTE: The artifact is written to a file private to this process and then
+     renamed into place, so that processes loading the same map in parallel
+     never read a partially written artifact. Failing to write the artifact
+     only costs the next launch the time to load the OSM file again.
+  */
+  const auto temporary_path =
+    boost::filesystem::path(map_artifact_path.string() + "." + std::to_string(::getpid()));
+
+  try {
+    boost::filesystem::create_directories(map_artifact_path.parent_path());
+
+    rclcpp::SerializedMessage serialized_markers;
+    rclcpp::Serialization<visualization_msgs::msg::MarkerArray>().serialize_message(
+      &markers_, &serialized_markers);
+    const auto & rcl_serialized_markers = serialized_markers.get_rcl_serialized_message();
+    const std::vector<std::uint8_t> marker_bytes(
+      rcl_serialized_markers.buffer,
+      rcl_serialized_markers.buffer + rcl_serialized_markers.buffer_length);
+
+    {
+      std::ofstream ofs(temporary_path.string(), std::ios::binary);
+      boost::archive::binary_oarchive oa(ofs);
+      oa << map_artifact_version << map_hash << map_bin_.data << marker_bytes;
+    }
+
+    boost::filesystem::rename(temporary_path, map_artifact_path);
+  } catch (const std::exception & exception) {
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("hdmap_utils"),
+      "Failed to save the map artifact " << map_artifact_path << ": " << exception.what());
+    boost::system::error_code error_code;
+    boost::filesystem::remove(temporary_path, error_code);
+  }
 }
 
 void HdMapUtils::insertMarkerArray(
@@ -1198,7 +1453,9 @@ void HdMapUtils::insertMarkerArray(
   a1.markers.insert(a1.markers.end(), a2.markers.begin(), a2.markers.end());
 }
 
-const visualization_msgs::msg::MarkerArray HdMapUtils::generateMarker() const
+const visualization_msgs::msg::MarkerArray HdMapUtils::generateMarker() const { return markers_; }
+
+const visualization_msgs::msg::MarkerArray HdMapUtils::generateMarkerArray() const
 {
   visualization_msgs::msg::MarkerArray markers;
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
@@ -77,7 +77,8 @@ geometry_msgs::msg::Pose constructPose(
 
 const simulation_api_schema::DetectionSensorConfiguration constructDetectionSensorConfiguration(
   const std::string & entity, const std::string & architecture_type, const double update_duration,
-  const double range, bool filter_by_range)
+  const double range, bool filter_by_range, bool filter_by_occlusion,
+  const double minimum_visible_ratio)
 {
   simulation_api_schema::DetectionSensorConfiguration configuration;
   configuration.set_entity(entity);
@@ -85,6 +86,8 @@ const simulation_api_schema::DetectionSensorConfiguration constructDetectionSens
   configuration.set_update_duration(update_duration);
   configuration.set_range(range);
   configuration.set_filter_by_range(filter_by_range);
+  configuration.set_filter_by_occlusion(filter_by_occlusion);
+  configuration.set_minimum_visible_ratio(minimum_visible_ratio);
   return configuration;
 }
 
@@ -23,21 +23,51 @@ void JobList::append(
   const std::function<bool(double)> & func_on_update, const std::function<void()> & func_on_cleanup,
   job::Type type, bool exclusive, const job::Event event)
 {
-  for (auto & job : list_) {
-    if (job.type == type && job.exclusive == exclusive && job.getStatus() == job::Status::ACTIVE) {
-      job.inactivate();
+  for (auto & [each_event, jobs] : list_) {
+    for (auto iter = jobs.begin(); iter != jobs.end();) {
+      if (iter->type == type && iter->exclusive == exclusive) {
+        iter->inactivate();
+        iter = jobs.erase(iter);
+        ++cancelled_;
+      } else {
+        ++iter;
+      }
     }
   }
-  list_.emplace_back(Job(func_on_update, func_on_cleanup, type, exclusive, event));
+  list_[event].emplace_back(func_on_update, func_on_cleanup, type, exclusive, event);
 }
 
 void JobList::update(const double step_time, const job::Event event)
 {
-  for (auto & job : list_) {
-    if (job.event == event) {
-      job.onUpdate(step_time);
+  if (auto found = list_.find(event); found != list_.end()) {
+    auto & jobs = found->second;
+    for (auto iter = jobs.begin(); iter != jobs.end();) {
+      iter->onUpdate(step_time);
+      if (iter->getStatus() == job::Status::INACTIVE) {
+        iter = jobs.erase(iter);
+        ++finished_;
+      } else {
+        ++iter;
+      }
     }
   }
 }
+
+JobList::Statistics JobList::getStatistics() const
+{
+  Statistics statistics;
+  for (const auto & [event, jobs] : list_) {
+    statistics.active += jobs.size();
+  }
+  statistics.finished = finished_;
+  statistics.cancelled = cancelled_;
+  return statistics;
+}
+
+std::ostream & operator<<(std::ostream & os, const JobList::Statistics & statistics)
+{
+  return os << statistics.active << " active, " << statistics.finished << " finished, "
+            << statistics.cancelled << " cancelled";
+}
 }  // namespace job
 }  // namespace traffic_simulator
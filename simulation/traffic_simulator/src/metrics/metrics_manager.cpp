@@ -39,6 +39,14 @@ bool MetricsManager::exists(const std::string & name) const
   return true;
 }
 
+void MetricsManager::reset()
+{
+  metrics_.clear();
+  log_ = nlohmann::json();
+  file_.close();
+  file_.open(log_path.string());
+}
+
 void MetricsManager::setVerbose(const bool verbose) { verbose_ = verbose; }
 
 MetricLifecycle MetricsManager::getLifecycle(const std::string & name)
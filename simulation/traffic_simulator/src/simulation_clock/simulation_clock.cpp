@@ -29,6 +29,7 @@ SimulationClock::SimulationClock(rcl_clock_type_t clock_type, bool use_raw_clock
 void SimulationClock::initialize(double initial_simulation_time, double step_time)
 {
   initialized_ = true;
+  is_npc_logic_started_ = false;
   initial_simulation_time_ = initial_simulation_time;
   current_simulation_time_ = initial_simulation_time_;
   step_time_ = step_time;
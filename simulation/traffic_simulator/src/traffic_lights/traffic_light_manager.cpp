@@ -35,9 +35,21 @@ auto TrafficLightManagerBase::deleteAllMarkers() const -> void
   marker_pub_->publish(message);
 }
 
+/*
+   NOTE: All the traffic lights are drawn again in a single message starting
+   with DELETEALL, rather than only the changed ones, because the publisher is
+   transient local with a depth of 1; the last message alone must be enough
+   for RViz started later. This is done only on frames where some traffic
+   light has changed.
+*/
 auto TrafficLightManagerBase::drawMarkers() const -> void
 {
   visualization_msgs::msg::MarkerArray marker_array;
+  {
+    visualization_msgs::msg::Marker marker;
+    marker.action = marker.DELETEALL;
+    marker_array.markers.push_back(marker);
+  }
 
   const auto now = clock_ptr_->now();
 
@@ -50,23 +62,34 @@ auto TrafficLightManagerBase::drawMarkers() const -> void
 
 auto TrafficLightManagerBase::hasAnyLightChanged() -> bool
 {
-  return true;
-  // return std::any_of(
-  //   std::begin(getTrafficLights()), std::end(getTrafficLights()), [](auto && id_and_traffic_light) {
-  //     return id_and_traffic_light.second.colorChanged() or
-  //            id_and_traffic_light.second.arrowChanged();
-  //   });
+  return not changed_traffic_light_ids_.empty();
+}
+
+auto TrafficLightManagerBase::reset() -> void
+{
+  deleteAllMarkers();
+
+  traffic_lights_.clear();  // NOTE: Traffic lights are created again on demand.
+
+  changed_traffic_light_ids_.clear();
 }
 
 auto TrafficLightManagerBase::update(const double) -> void
 {
+  changed_traffic_light_ids_.clear();
+
+  for (auto && [id, traffic_light] : traffic_lights_) {
+    if (traffic_light.changed()) {
+      changed_traffic_light_ids_.push_back(id);
+      traffic_light.commit();
+    }
+  }
+
   publishTrafficLightStateArray();
 
   if (hasAnyLightChanged()) {
-    deleteAllMarkers();
+    drawMarkers();
   }
-
-  drawMarkers();
 }
 
 template <>
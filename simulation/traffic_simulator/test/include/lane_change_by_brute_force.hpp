@@ -0,0 +1,82 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TEST__LANE_CHANGE_BY_BRUTE_FORCE_HPP_
+#define TRAFFIC_SIMULATOR__TEST__LANE_CHANGE_BY_BRUTE_FORCE_HPP_
+
+#include <quaternion_operation/quaternion_operation.h>
+
+#include <algorithm>
+#include <boost/optional.hpp>
+#include <cmath>
+#include <cstdint>
+#include <geometry/spline/hermite_curve.hpp>
+#include <geometry/transform.hpp>
+#include <iterator>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <utility>
+#include <vector>
+
+/*
+   The search done by HdMapUtils::getLaneChangeTrajectory before it searched
+   coarse-to-fine: every 1 m of the target lanelet, constructing a curve for
+   each. Kept as the reference of the test and the baseline of the benchmark.
+*/
+inline auto getLaneChangeTrajectoryByBruteForce(
+  hdmap_utils::HdMapUtils & hdmap_utils, const geometry_msgs::msg::Pose & from_pose,
+  std::int64_t to_lanelet_id, double maximum_curvature_threshold, double target_trajectory_length,
+  double forward_distance_threshold)
+  -> boost::optional<std::pair<math::geometry::HermiteCurve, double>>
+{
+  std::vector<double> evaluation, target_s;
+  std::vector<math::geometry::HermiteCurve> curves;
+
+  for (double to_s = 0; to_s < hdmap_utils.getLaneletLength(to_lanelet_id); to_s = to_s + 1.0) {
+    const auto goal_pose = hdmap_utils.toMapPose(to_lanelet_id, to_s, 0).pose;
+    if (
+      math::geometry::getRelativePose(from_pose, goal_pose).position.x <=
+      forward_distance_threshold) {
+      continue;
+    }
+    const auto tangent_vector_size =
+      0.5 * std::hypot(
+              from_pose.position.x - goal_pose.position.x,
+              from_pose.position.y - goal_pose.position.y,
+              from_pose.position.z - goal_pose.position.z);
+    const auto yaw = quaternion_operation::convertQuaternionToEulerAngle(from_pose.orientation).z;
+    geometry_msgs::msg::Vector3 start_vec;
+    start_vec.x = tangent_vector_size * std::cos(yaw);
+    start_vec.y = tangent_vector_size * std::sin(yaw);
+    auto goal_vec = hdmap_utils.getTangentVector(to_lanelet_id, to_s).get();
+    goal_vec.x *= tangent_vector_size;
+    goal_vec.y *= tangent_vector_size;
+    goal_vec.z *= tangent_vector_size;
+    const auto curve = math::geometry::HermiteCurve(
+      from_pose, hdmap_utils.toMapPose(to_lanelet_id, to_s, 0).pose, start_vec, goal_vec);
+    if (curve.getMaximum2DCurvature() < maximum_curvature_threshold) {
+      evaluation.push_back(std::fabs(target_trajectory_length - curve.getLength()));
+      curves.push_back(curve);
+      target_s.push_back(to_s);
+    }
+  }
+  if (evaluation.empty()) {
+    return boost::none;
+  } else {
+    const auto index = std::distance(
+      evaluation.begin(), std::min_element(evaluation.begin(), evaluation.end()));
+    return std::make_pair(curves[index], target_s[index]);
+  }
+}
+
+#endif  // TRAFFIC_SIMULATOR__TEST__LANE_CHANGE_BY_BRUTE_FORCE_HPP_
@@ -0,0 +1,96 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/metrics/metrics.hpp>
+
+#include "catalogs.hpp"
+
+namespace
+{
+auto makeNode(const std::string & name)
+{
+  return std::make_shared<rclcpp::Node>(
+    name, rclcpp::NodeOptions().parameter_overrides(
+            {rclcpp::Parameter("origin_latitude", 35.61836750154),
+             rclcpp::Parameter("origin_longitude", 139.78066608243)}));
+}
+
+/*
+   NOTE: Standalone mode, so that no simple_sensor_simulator is needed.
+*/
+auto makeConfiguration(const std::string & name)
+{
+  auto configuration = traffic_simulator::Configuration(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map");
+  configuration.standalone_mode = true;
+  configuration.metrics_log_path =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path(name + "-%%%%-%%%%.json");
+  return configuration;
+}
+}  // namespace
+
+TEST(API, reset)
+{
+  const auto node = makeNode("reset");
+  const auto configuration = makeConfiguration("reset");
+  traffic_simulator::API api(node, configuration);
+  ASSERT_TRUE(api.initialize(1.0, 0.05));
+  ASSERT_TRUE(api.spawn(
+    "npc", traffic_simulator::helper::constructLaneletPose(34513, 0), getVehicleParameters()));
+  api.addMetric<metrics::TraveledDistanceMetric>("traveled_distance", "npc");
+  api.getTrafficLight(34836).emplace(traffic_simulator::TrafficLight::Color::red);
+  api.startNpcLogic();
+  ASSERT_TRUE(api.updateFrame());
+
+  api.reset();
+
+  const auto fresh_node = makeNode("reset_fresh");
+  const auto fresh_configuration = makeConfiguration("reset_fresh");
+  traffic_simulator::API fresh_api(fresh_node, fresh_configuration);
+  EXPECT_EQ(api.getEntityNames(), fresh_api.getEntityNames());
+  EXPECT_EQ(api.metricExists("traveled_distance"), fresh_api.metricExists("traveled_distance"));
+  EXPECT_EQ(api.getTrafficLights().size(), fresh_api.getTrafficLights().size());
+  EXPECT_EQ(api.isNpcLogicStarted(), fresh_api.isNpcLogicStarted());
+  EXPECT_EQ(
+    api.getHdmapUtils()->getRoute(34684, 34510), fresh_api.getHdmapUtils()->getRoute(34684, 34510));
+
+  /*
+     The next scenario initializes the reset API again, and may reuse the
+     names of the previous one.
+  */
+  ASSERT_TRUE(api.initialize(1.0, 0.05));
+  EXPECT_TRUE(api.spawn(
+    "npc", traffic_simulator::helper::constructLaneletPose(34513, 0), getVehicleParameters()));
+  EXPECT_TRUE(api.updateFrame());
+
+  boost::filesystem::remove(configuration.metrics_log_path);
+  boost::filesystem::remove(fresh_configuration.metrics_log_path);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
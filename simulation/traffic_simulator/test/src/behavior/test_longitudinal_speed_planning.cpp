@@ -0,0 +1,124 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
+#include <tuple>
+
+namespace
+{
+using traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner;
+
+/*
+   The distance getRunningDistance accumulated by stepping getDynamicStates
+   before it was solved in closed form.
+*/
+auto simulateRunningDistance(
+  const LongitudinalSpeedPlanner & planner, double target_speed,
+  const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
+  const geometry_msgs::msg::Twist & current_twist, const geometry_msgs::msg::Accel & current_accel)
+{
+  if (planner.isTargetSpeedReached(target_speed, current_twist, 0.01)) {
+    return 0.0;
+  }
+  const auto dt = planner.step_time;
+  auto state = std::make_tuple(current_twist, current_accel, 0.0);
+  double distance = 0;
+  do {
+    state =
+      planner.getDynamicStates(target_speed, constraints, std::get<0>(state), std::get<1>(state));
+    distance += std::get<0>(state).linear.x * dt + std::get<1>(state).linear.x * dt * dt / 2 +
+                std::get<2>(state) * dt * dt * dt / 6;
+  } while (not planner.isTargetSpeedReached(target_speed, std::get<0>(state), 0.01));
+  return distance;
+}
+
+auto makeConstraints(double max_speed, double acceleration, double acceleration_rate)
+{
+  traffic_simulator_msgs::msg::DynamicConstraints constraints;
+  constraints.max_speed = max_speed;
+  constraints.max_acceleration = acceleration;
+  constraints.max_acceleration_rate = acceleration_rate;
+  constraints.max_deceleration = acceleration;
+  constraints.max_deceleration_rate = acceleration_rate;
+  return constraints;
+}
+
+auto makeTwist(double speed)
+{
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = speed;
+  return twist;
+}
+
+auto makeAccel(double acceleration)
+{
+  geometry_msgs::msg::Accel accel;
+  accel.linear.x = acceleration;
+  return accel;
+}
+}  // namespace
+
+TEST(LongitudinalSpeedPlanner, RunningDistanceTargetSpeedReached)
+{
+  const auto planner = LongitudinalSpeedPlanner(0.05, "entity");
+  EXPECT_DOUBLE_EQ(
+    planner.getRunningDistance(
+      10.0, makeConstraints(20.0, 3.0, 3.0), makeTwist(10.005), makeAccel(0.0), 0.0),
+    0.0);
+}
+
+TEST(LongitudinalSpeedPlanner, RunningDistanceStop)
+{
+  const auto planner = LongitudinalSpeedPlanner(1.0 / 30, "entity");
+  const auto constraints = makeConstraints(30.0, 0.1, 0.1);
+  const auto expected =
+    simulateRunningDistance(planner, 0.0, constraints, makeTwist(20.0), makeAccel(0.0));
+  EXPECT_NEAR(
+    planner.getRunningDistance(0.0, constraints, makeTwist(20.0), makeAccel(0.0), 0.0), expected,
+    1e-6 * expected);
+}
+
+TEST(LongitudinalSpeedPlanner, RunningDistanceMatchesSimulation)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  for (int i = 0; i < 1000; ++i) {
+    traffic_simulator_msgs::msg::DynamicConstraints constraints;
+    constraints.max_speed = 5.0 + 40.0 * uniform(engine);
+    constraints.max_acceleration = 0.05 + 5.0 * uniform(engine);
+    constraints.max_acceleration_rate = 0.05 + 5.0 * uniform(engine);
+    constraints.max_deceleration = 0.05 + 5.0 * uniform(engine);
+    constraints.max_deceleration_rate = 0.05 + 5.0 * uniform(engine);
+    const auto planner = LongitudinalSpeedPlanner(i % 2 == 0 ? 0.05 : 0.1, "entity");
+    const auto twist = makeTwist(
+      std::min((2.0 * uniform(engine) - 0.3) * constraints.max_speed, constraints.max_speed));
+    const auto accel = makeAccel(12.0 * uniform(engine) - 6.0);
+    const auto target_speed = constraints.max_speed * uniform(engine);
+    const auto expected = simulateRunningDistance(planner, target_speed, constraints, twist, accel);
+    EXPECT_NEAR(
+      planner.getRunningDistance(target_speed, constraints, twist, accel, 0.0), expected,
+      1e-6 * std::max(1.0, std::abs(expected)));
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
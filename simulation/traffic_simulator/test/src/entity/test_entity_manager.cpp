@@ -0,0 +1,87 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cmath>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+#include "catalogs.hpp"
+
+namespace
+{
+auto makeNode(const std::string & name)
+{
+  return std::make_shared<rclcpp::Node>(
+    name, rclcpp::NodeOptions().parameter_overrides(
+            {rclcpp::Parameter("origin_latitude", 35.61836750154),
+             rclcpp::Parameter("origin_longitude", 139.78066608243)}));
+}
+
+auto makeConfiguration()
+{
+  return traffic_simulator::Configuration(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map");
+}
+}  // namespace
+
+TEST(EntityManager, reset)
+{
+  const auto node = makeNode("reset");
+  traffic_simulator::entity::EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<traffic_simulator::entity::VehicleEntity>(
+    "npc", traffic_simulator::helper::constructLaneletPose(34513, 0), getVehicleParameters());
+  manager.requestSpeedChange("npc", 5, true);
+  manager.startNpcLogic();
+  manager.update(0, 0.05);
+  manager.getTrafficLight(34836).emplace(traffic_simulator::TrafficLight::Color::red);
+  const auto route = manager.getHdmapUtils()->getRoute(34684, 34510);
+  ASSERT_EQ(manager.getEntityNames().size(), static_cast<std::size_t>(1));
+  ASSERT_EQ(manager.getTrafficLights().size(), static_cast<std::size_t>(1));
+
+  manager.reset();
+
+  const auto fresh_node = makeNode("reset_fresh");
+  traffic_simulator::entity::EntityManager fresh_manager(fresh_node, makeConfiguration());
+  EXPECT_EQ(manager.getEntityNames(), fresh_manager.getEntityNames());
+  EXPECT_FALSE(manager.entityExists("npc"));
+  EXPECT_EQ(manager.getTrafficLights().size(), fresh_manager.getTrafficLights().size());
+  EXPECT_EQ(manager.isNpcLogicStarted(), fresh_manager.isNpcLogicStarted());
+  EXPECT_TRUE(std::isnan(manager.getCurrentTime()));
+  /*
+     NOTE: The route cache depends only on the map, so reset keeps it. What
+     matters is that the routes it answers are the ones a fresh instance
+     computes.
+  */
+  EXPECT_EQ(manager.getHdmapUtils()->getRoute(34684, 34510), route);
+  EXPECT_EQ(fresh_manager.getHdmapUtils()->getRoute(34684, 34510), route);
+
+  /*
+     The reset instance must be usable for the next scenario, including the
+     entity name used by the previous one.
+  */
+  EXPECT_NO_THROW(manager.spawnEntity<traffic_simulator::entity::VehicleEntity>(
+    "npc", traffic_simulator::helper::constructLaneletPose(34513, 0), getVehicleParameters()));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,7 +18,7 @@
 #include <traffic_simulator/entity/vehicle_entity.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 
-#include "../catalogs.hpp"
+#include "catalogs.hpp"
 #include "../expect_eq_macros.hpp"
 
 /*
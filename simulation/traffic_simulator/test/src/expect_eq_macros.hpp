@@ -65,6 +65,8 @@
 #define EXPECT_DETECTION_SENSOR_CONFIGURATION_EQ(DATA0, DATA1)                        \
   EXPECT_STREQ(DATA0.entity().c_str(), DATA1.entity().c_str());                       \
   EXPECT_STREQ(DATA0.architecture_type().c_str(), DATA1.architecture_type().c_str()); \
-  EXPECT_DOUBLE_EQ(DATA0.update_duration(), DATA1.update_duration());
+  EXPECT_DOUBLE_EQ(DATA0.update_duration(), DATA1.update_duration());                 \
+  EXPECT_EQ(DATA0.filter_by_occlusion(), DATA1.filter_by_occlusion());                \
+  EXPECT_DOUBLE_EQ(DATA0.minimum_visible_ratio(), DATA1.minimum_visible_ratio());
 
 #endif  // TRAFFIC_SIMULATOR__TEST__EXPECT_EQ_MACROS_HPP_
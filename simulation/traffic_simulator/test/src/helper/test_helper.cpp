@@ -85,6 +85,19 @@ TEST(HELPER, DETECTION_SENSOR_CONFIGURATION)
   EXPECT_DETECTION_SENSOR_CONFIGURATION_EQ(configuration, expect_configuration);
 }
 
+TEST(HELPER, OCCLUSION_AWARE_DETECTION_SENSOR_CONFIGURATION)
+{
+  const auto configuration = traffic_simulator::helper::constructDetectionSensorConfiguration(
+    "ego", "test", 3, 300.0, false, true, 0.25);
+  simulation_api_schema::DetectionSensorConfiguration expect_configuration;
+  expect_configuration.set_architecture_type("test");
+  expect_configuration.set_entity("ego");
+  expect_configuration.set_update_duration(3.0);
+  expect_configuration.set_filter_by_occlusion(true);
+  expect_configuration.set_minimum_visible_ratio(0.25);
+  EXPECT_DETECTION_SENSOR_CONFIGURATION_EQ(configuration, expect_configuration);
+}
+
 TEST(HELPER, LIDAR_SENSOR_CONFIGURATION)
 {
   EXPECT_NO_THROW(traffic_simulator::helper::constructLidarConfiguration(
@@ -0,0 +1,62 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <traffic_simulator/job/job_list.hpp>
+
+TEST(JobList, RemoveFinishedJobs)
+{
+  traffic_simulator::job::JobList job_list;
+  int cleanup_count = 0;
+  job_list.append(
+    [](const double duration) { return duration >= 0.2; }, [&]() { ++cleanup_count; },
+    traffic_simulator::job::Type::LINEAR_VELOCITY, false,
+    traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_EQ(job_list.getStatistics().active, static_cast<std::size_t>(1));
+  job_list.update(0.1, traffic_simulator::job::Event::PRE_UPDATE);
+  job_list.update(0.1, traffic_simulator::job::Event::POST_UPDATE);
+  job_list.update(0.1, traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_EQ(job_list.getStatistics().active, static_cast<std::size_t>(1));
+  job_list.update(0.1, traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_EQ(job_list.getStatistics().active, static_cast<std::size_t>(0));
+  EXPECT_EQ(job_list.getStatistics().finished, static_cast<std::size_t>(1));
+  EXPECT_EQ(cleanup_count, 1);
+}
+
+TEST(JobList, CancelExclusiveJobs)
+{
+  traffic_simulator::job::JobList job_list;
+  int cleanup_count = 0;
+  for (int i = 0; i < 100; ++i) {
+    job_list.append(
+      [](const double) { return false; }, [&]() { ++cleanup_count; },
+      traffic_simulator::job::Type::LINEAR_ACCELERATION, true,
+      traffic_simulator::job::Event::POST_UPDATE);
+  }
+  job_list.append(
+    [](const double) { return false; }, [&]() { ++cleanup_count; },
+    traffic_simulator::job::Type::LINEAR_VELOCITY, true, traffic_simulator::job::Event::PRE_UPDATE);
+  const auto statistics = job_list.getStatistics();
+  EXPECT_EQ(statistics.active, static_cast<std::size_t>(2));
+  EXPECT_EQ(statistics.finished, static_cast<std::size_t>(0));
+  EXPECT_EQ(statistics.cancelled, static_cast<std::size_t>(99));
+  EXPECT_EQ(cleanup_count, 99);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
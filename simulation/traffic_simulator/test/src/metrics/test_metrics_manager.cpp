@@ -0,0 +1,83 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/metrics/metrics.hpp>
+#include <traffic_simulator/metrics/metrics_manager.hpp>
+
+#include "catalogs.hpp"
+
+namespace
+{
+auto readFile(const boost::filesystem::path & path)
+{
+  std::ifstream ifs(path.string());
+  return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+TEST(MetricsManager, reset)
+{
+  const auto node = std::make_shared<rclcpp::Node>(
+    "reset", rclcpp::NodeOptions().parameter_overrides(
+               {rclcpp::Parameter("origin_latitude", 35.61836750154),
+                rclcpp::Parameter("origin_longitude", 139.78066608243)}));
+  const auto entity_manager_ptr = std::make_shared<traffic_simulator::entity::EntityManager>(
+    node, traffic_simulator::Configuration(
+            ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map"));
+  entity_manager_ptr->spawnEntity<traffic_simulator::entity::VehicleEntity>(
+    "npc", traffic_simulator::helper::constructLaneletPose(34513, 0), getVehicleParameters());
+  entity_manager_ptr->update(0, 0.05);
+
+  const auto directory = boost::filesystem::temp_directory_path() /
+                         boost::filesystem::unique_path("test_metrics_manager-%%%%-%%%%");
+  boost::filesystem::create_directories(directory);
+  {
+    metrics::MetricsManager manager(directory / "reset.json");
+    manager.setEntityManager(entity_manager_ptr);
+    manager.addMetric<metrics::TraveledDistanceMetric>("traveled_distance", "npc");
+    manager.calculate();
+    ASSERT_TRUE(manager.exists("traveled_distance"));
+    manager.reset();
+    EXPECT_FALSE(manager.exists("traveled_distance"));
+    EXPECT_THROW(manager.getLifecycle("traveled_distance"), common::SemanticError);
+  }
+  {
+    metrics::MetricsManager fresh_manager(directory / "fresh.json");
+  }
+  /*
+     The log written on destruction must not contain anything calculated
+     before the reset.
+  */
+  EXPECT_EQ(readFile(directory / "reset.json"), readFile(directory / "fresh.json"));
+  boost::filesystem::remove_all(directory);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <traffic_simulator/hdmap_utils/cache.hpp>
+#include <vector>
+
+TEST(RouteCache, EvictLeastRecentlyUsed)
+{
+  hdmap_utils::RouteCache cache(2);
+  cache.appendData(1, 2, {1, 3, 2});
+  cache.appendData(2, 3, {2, 3});
+  EXPECT_TRUE(cache.find(1, 2));
+  cache.appendData(3, 4, {3, 5, 6, 4});
+  EXPECT_FALSE(cache.exists(2, 3));
+  EXPECT_EQ(cache.getRoute(1, 2), (std::vector<std::int64_t>{1, 3, 2}));
+  EXPECT_EQ(cache.getRoute(3, 4), (std::vector<std::int64_t>{3, 5, 6, 4}));
+  const auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.size, 2U);
+  EXPECT_EQ(statistics.capacity, 2U);
+  EXPECT_EQ(statistics.hits, 3U);
+  EXPECT_EQ(statistics.misses, 1U);
+  EXPECT_EQ(statistics.evictions, 1U);
+}
+
+TEST(RouteCache, Compact)
+{
+  hdmap_utils::RouteCache cache(3);
+  for (std::int64_t i = 0; i < 100; ++i) {
+    cache.appendData(i, i + 1, std::vector<std::int64_t>(i % 7, i));
+  }
+  for (std::int64_t i = 97; i < 100; ++i) {
+    EXPECT_EQ(cache.getRoute(i, i + 1), std::vector<std::int64_t>(i % 7, i));
+  }
+  cache.appendData(99, 100, {99, 42, 100});
+  EXPECT_EQ(cache.getRoute(99, 100), (std::vector<std::int64_t>{99, 42, 100}));
+  EXPECT_EQ(cache.getRoute(98, 99), std::vector<std::int64_t>(98 % 7, 98));
+  EXPECT_THROW(cache.getRoute(0, 1), common::SimulationError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,10 +14,21 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <geometry/transform.hpp>
+#include <iterator>
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
+#include <utility>
+#include <vector>
+
+#include "lane_change_by_brute_force.hpp"
 
 TEST(HdMapUtils, Construct)
 {
@@ -30,6 +41,102 @@ TEST(HdMapUtils, Construct)
   ASSERT_NO_THROW(hdmap_utils.toMapBin());
 }
 
+TEST(HdMapUtils, LoadMapArtifact)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+
+  /*
+     NOTE: Map artifacts are stored under the temporary directory, so an empty
+     one forces the first instance to load the OSM file and the second one to
+     load the artifact the first one saved.
+  */
+  const auto previous_tmpdir = std::getenv("TMPDIR");
+  const std::string saved_tmpdir = previous_tmpdir ? previous_tmpdir : "";
+  const auto tmpdir = boost::filesystem::temp_directory_path() /
+                      boost::filesystem::unique_path("test_hdmap_utils-%%%%-%%%%");
+  boost::filesystem::create_directories(tmpdir);
+  setenv("TMPDIR", tmpdir.c_str(), 1);
+
+  auto count_artifacts = [&]() {
+    const auto directory = tmpdir / "traffic_simulator";
+    return boost::filesystem::exists(directory)
+             ? std::distance(
+                 boost::filesystem::directory_iterator(directory),
+                 boost::filesystem::directory_iterator())
+             : 0;
+  };
+
+  ASSERT_EQ(count_artifacts(), 0);
+  hdmap_utils::HdMapUtils loaded(path, origin);
+  ASSERT_EQ(count_artifacts(), 1);
+  hdmap_utils::HdMapUtils restored(path, origin);
+
+  if (previous_tmpdir) {
+    setenv("TMPDIR", saved_tmpdir.c_str(), 1);
+  } else {
+    unsetenv("TMPDIR");
+  }
+  boost::filesystem::remove_all(tmpdir);
+
+  auto loaded_ids = loaded.getLaneletIds();
+  auto restored_ids = restored.getLaneletIds();
+  std::sort(loaded_ids.begin(), loaded_ids.end());
+  std::sort(restored_ids.begin(), restored_ids.end());
+  EXPECT_EQ(loaded_ids, restored_ids);
+  EXPECT_EQ(loaded.toMapBin().data, restored.toMapBin().data);
+  EXPECT_EQ(loaded.generateMarker().markers.size(), restored.generateMarker().markers.size());
+  EXPECT_DOUBLE_EQ(loaded.getLaneletLength(34513), restored.getLaneletLength(34513));
+}
+
+TEST(HdMapUtils, LongitudinalDistance)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  {
+    const auto distance = hdmap_utils.getLongitudinalDistance(34513, 10.0, 34510, 5.0);
+    EXPECT_TRUE(distance);
+    EXPECT_DOUBLE_EQ(distance.get(), hdmap_utils.getLaneletLength(34513) - 10.0 + 5.0);
+  }
+  {
+    const auto distance = hdmap_utils.getLongitudinalDistance(34684, 0.0, 34510, 0.0);
+    EXPECT_TRUE(distance);
+    EXPECT_DOUBLE_EQ(
+      distance.get(), hdmap_utils.getLaneletLength(34684) + hdmap_utils.getLaneletLength(34513));
+  }
+  EXPECT_FALSE(hdmap_utils.getLongitudinalDistance(34513, 10.0, 34513, 5.0));
+}
+
+TEST(HdMapUtils, LongitudinalDistances)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto from = traffic_simulator::helper::constructLaneletPose(34684, 1.0, 0);
+  const auto distances = hdmap_utils.getLongitudinalDistances(from, 200.0);
+  EXPECT_FALSE(distances.empty());
+  for (const auto & [lanelet_id, distance] : distances) {
+    if (lanelet_id == from.lanelet_id) {
+      continue;
+    }
+    EXPECT_LE(distance, 200.0);
+    const auto expected = hdmap_utils.getLongitudinalDistance(34684, 1.0, lanelet_id, 0.0);
+    EXPECT_TRUE(expected);
+    EXPECT_DOUBLE_EQ(distance, expected.get());
+  }
+  EXPECT_TRUE(hdmap_utils.getLongitudinalDistances(from, 0.0).empty());
+}
+
 TEST(HdMapUtils, MatchToLane)
 {
   std::string path =
@@ -98,6 +205,66 @@ TEST(HdMapUtils, AlongLaneletPose)
     hdmap_utils.getLaneletLength(34684) - 10.0);
 }
 
+TEST(HdMapUtils, LaneChangeTrajectory)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto from_pose = hdmap_utils.toMapPose(34462, 5.0, 0).pose;
+  const auto parameter = traffic_simulator::lane_change::Parameter(
+    traffic_simulator::lane_change::AbsoluteTarget(34513, 0));
+  const auto trajectory =
+    hdmap_utils.getLaneChangeTrajectory(from_pose, parameter, 10.0, 20.0, 1.0);
+  ASSERT_TRUE(trajectory);
+  EXPECT_LT(trajectory->first.getMaximum2DCurvature(), 10.0);
+  EXPECT_GE(trajectory->second, 0.0);
+  EXPECT_LT(trajectory->second, hdmap_utils.getLaneletLength(34513));
+  EXPECT_DOUBLE_EQ(trajectory->second, std::round(trajectory->second));
+  const auto goal_pose = hdmap_utils.toMapPose(34513, trajectory->second, 0).pose;
+  EXPECT_GT(math::geometry::getRelativePose(from_pose, goal_pose).position.x, 1.0);
+}
+
+TEST(HdMapUtils, LaneChangeTrajectoryMatchesBruteForce)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  /*
+     Pairs of lanelets side by side across a dashed line, in both directions,
+     starting from several positions.
+  */
+  for (const auto & [from_lanelet_id, to_lanelet_id] :
+       std::vector<std::pair<std::int64_t, std::int64_t>>{
+         {34462, 34513}, {34513, 34462}, {34465, 34510}, {34510, 34465}, {34468, 34507},
+         {34507, 34468}}) {
+    for (const auto from_s : {0.0, 5.0, 15.0}) {
+      SCOPED_TRACE(
+        std::to_string(from_lanelet_id) + " (s = " + std::to_string(from_s) + ") -> " +
+        std::to_string(to_lanelet_id));
+      const auto from_pose = hdmap_utils.toMapPose(from_lanelet_id, from_s, 0).pose;
+      const auto parameter = traffic_simulator::lane_change::Parameter(
+        traffic_simulator::lane_change::AbsoluteTarget(to_lanelet_id, 0));
+      const auto trajectory =
+        hdmap_utils.getLaneChangeTrajectory(from_pose, parameter, 10.0, 20.0, 1.0);
+      const auto expected = getLaneChangeTrajectoryByBruteForce(
+        hdmap_utils, from_pose, to_lanelet_id, 10.0, 20.0, 1.0);
+      ASSERT_EQ(static_cast<bool>(trajectory), static_cast<bool>(expected));
+      if (trajectory) {
+        EXPECT_DOUBLE_EQ(trajectory->second, expected->second);
+        EXPECT_DOUBLE_EQ(trajectory->first.getLength(), expected->first.getLength());
+        EXPECT_DOUBLE_EQ(
+          trajectory->first.getMaximum2DCurvature(), expected->first.getMaximum2DCurvature());
+      }
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -93,6 +93,64 @@ TEST(TrafficLightManager, setArrow)
   }
 }
 
+TEST(TrafficLightManager, changedTrafficLightIds)
+{
+  const auto node = std::make_shared<rclcpp::Node>("changedTrafficLightIds");
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils_ptr = std::make_shared<hdmap_utils::HdMapUtils>(path, origin);
+  traffic_simulator::TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>
+    manager(hdmap_utils_ptr, node, "map");
+  using Color = traffic_simulator::TrafficLight::Color;
+  manager.getTrafficLight(34836).emplace(Color::green);
+  manager.getTrafficLight(34802).emplace(Color::red);
+  manager.update(0.1);
+  EXPECT_TRUE(manager.hasAnyLightChanged());
+  EXPECT_EQ(manager.getChangedTrafficLightIds().size(), static_cast<std::size_t>(2));
+  manager.update(0.1);
+  EXPECT_FALSE(manager.hasAnyLightChanged());
+  manager.getTrafficLight(34836).clear();
+  manager.getTrafficLight(34836).emplace(Color::green);
+  manager.getTrafficLight(34802).clear();
+  manager.getTrafficLight(34802).emplace(Color::yellow);
+  manager.update(0.1);
+  EXPECT_TRUE(manager.hasAnyLightChanged());
+  EXPECT_EQ(manager.getChangedTrafficLightIds(), std::vector<std::int64_t>({34802}));
+}
+
+TEST(TrafficLightManager, reset)
+{
+  const auto node = std::make_shared<rclcpp::Node>("reset");
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils_ptr = std::make_shared<hdmap_utils::HdMapUtils>(path, origin);
+  traffic_simulator::TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>
+    manager(hdmap_utils_ptr, node, "map");
+  using Color = traffic_simulator::TrafficLight::Color;
+  using Status = traffic_simulator::TrafficLight::Status;
+  using Shape = traffic_simulator::TrafficLight::Shape;
+  manager.getTrafficLight(34836).emplace(Color::red);
+  manager.getTrafficLight(34802).emplace(Color::yellow);
+  manager.update(0.1);
+  ASSERT_TRUE(manager.hasAnyLightChanged());
+  manager.reset();
+  traffic_simulator::TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>
+    fresh_manager(hdmap_utils_ptr, node, "map");
+  EXPECT_EQ(manager.getTrafficLights().size(), fresh_manager.getTrafficLights().size());
+  EXPECT_EQ(manager.getChangedTrafficLightIds(), fresh_manager.getChangedTrafficLightIds());
+  EXPECT_EQ(manager.hasAnyLightChanged(), fresh_manager.hasAnyLightChanged());
+  EXPECT_FALSE(
+    manager.getTrafficLight(34836).contains(Color::red, Status::solid_on, Shape::circle));
+  EXPECT_FALSE(
+    manager.getTrafficLight(34802).contains(Color::yellow, Status::solid_on, Shape::circle));
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
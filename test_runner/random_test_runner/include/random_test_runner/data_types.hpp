@@ -59,6 +59,9 @@ struct TestControlParameters
   SimulatorType simulator_type = SimulatorType::SIMPLE_SENSOR_SIMULATOR;
   ArchitectureType architecture_type = ArchitectureType::AWF_UNIVERSE;
   std::string simulator_host = "localhost";
+  int64_t port_offset = 0;
+  int64_t shard_count = 1;
+  int64_t shard_index = 0;
 };
 
 struct TestSuiteParameters
@@ -128,8 +131,10 @@ DEFINE_FMT_FORMATTER(
   v.name, v.lanelet_pose, v.pose, v.action_status, v.time, v.lanelet_pose_valid, v.type)
 
 DEFINE_FMT_FORMATTER(
-  TestControlParameters, "input dir: {} output dir: {} random test type: {} test count {}",
-  v.input_dir, v.output_dir, v.random_test_type, v.test_count)
+  TestControlParameters,
+  "input dir: {} output dir: {} random test type: {} test count {} shard {}/{} port offset {}",
+  v.input_dir, v.output_dir, v.random_test_type, v.test_count, v.shard_index, v.shard_count,
+  v.port_offset)
 
 DEFINE_FMT_FORMATTER(
   TestSuiteParameters,
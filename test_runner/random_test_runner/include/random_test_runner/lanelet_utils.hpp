@@ -19,8 +19,12 @@
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <boost/filesystem.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "random_test_runner/data_types.hpp"
@@ -63,10 +67,34 @@ public:
   double getLaneletLength(int64_t lanelet_id);
   bool isInLanelet(int64_t lanelet_id, double s);
 
+  // Sampling tables, built once per map and shared by all test cases
+
+  // Number of lanelets passable by vehicles, i.e. the range of the index given to
+  // sampleLaneletIdWeightedByLength
+  std::size_t getSamplingTableSize() const;
+  // Lanelet passable by vehicles, chosen with a probability proportional to its length from a
+  // uniformly random index in [0, getSamplingTableSize()) and a uniformly random value in [0, 1)
+  int64_t sampleLaneletIdWeightedByLength(std::size_t index, double uniform) const;
+  // Equivalent to !getRoute(from_lanelet_id, to_lanelet_id).empty(), in constant time
+  bool isReachable(int64_t from_lanelet_id, int64_t to_lanelet_id) const;
+
 private:
+  void buildSamplingTables(const lanelet::traffic_rules::TrafficRules & traffic_rules);
+
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::routing::RoutingGraphConstPtr vehicle_routing_graph_ptr_;
   std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_ptr_;
+
+  // Alias table (Vose) of the lanelets passable by vehicles weighted by their length
+  std::vector<int64_t> sampling_lanelet_ids_;
+  std::vector<double> sampling_probabilities_;
+  std::vector<std::size_t> sampling_aliases_;
+
+  // Strongly connected component of each lanelet passable by vehicles in the routing graph
+  // (without lane changes, as HdMapUtils::getRoute), and the set of components reachable from
+  // each component as a bitmap
+  std::unordered_map<int64_t, std::size_t> component_of_lanelet_;
+  std::vector<std::vector<uint64_t>> reachable_components_;
 };
 
 #endif  // RANDOM_TEST_RUNNER__LANELET_UTILS_HPP
@@ -59,7 +59,6 @@ private:
   rclcpp::Logger logger_;
 
   std::shared_ptr<LaneletUtils> lanelet_utils_;
-  std::vector<int64_t> lanelet_ids_;
 
   RandomizationEnginePtr randomization_engine_;
   LaneletIdRandomizer lanelet_id_randomizer_;
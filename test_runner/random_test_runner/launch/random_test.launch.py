@@ -20,8 +20,12 @@
 # Co-developed by TIER IV, Inc. and Robotec.AI sp. z o.o.
 
 import os
+import random
+import xml.etree.ElementTree as ET
 
 from ament_index_python.packages import get_package_share_directory
+from pathlib import Path
+from yaml import safe_dump, safe_load
 
 from launch import LaunchDescription
 
@@ -89,6 +93,11 @@ class RandomTestRunnerLaunch(object):
 
             # control arguments #
             "test_count": {"default": 5, "description": "Test count to be performed in test suite"},
+            "workers":
+                {"default": 1,
+                 "description": "Number of worker processes. Each worker runs its own simulator and "
+                                "every workers-th test case of the suite, and the results of all "
+                                "workers are merged into output_dir"},
             "input_dir":
                 {"default": "",
                  "description": "Directory containing the result.yaml file to be replayed. "
@@ -127,7 +136,9 @@ class RandomTestRunnerLaunch(object):
                                         "description": "Maximum distance of generated npcs from ego"},
 
             # test case arguments #
-            "seed": {"default": -1, "description": "Randomization seed. If -1, seed will be generated for each test"},
+            "seed": {"default": -1,
+                     "description": "Randomization seed of the test suite. The n-th test case uses seed + n. "
+                                    "If -1, the seed of the test suite is generated randomly"},
         }
 
     def collect_random_test_launch_configuration(self):
@@ -202,6 +213,10 @@ class RandomTestRunnerLaunch(object):
                 parameters.append(vehicle_info_param_file_path)
                 parameters.append(simulator_model_param_file_path)
 
+        workers = int(self.random_test_runner_launch_configuration["workers"].perform(context))
+        if workers > 1:
+            return self.parallel_launch_description(context, parameters, workers)
+
         scenario_node = Node(
             package="random_test_runner",
             executable="random_test_runner",
@@ -245,6 +260,132 @@ class RandomTestRunnerLaunch(object):
 
         return launch_description
 
+    def parallel_launch_description(self, context, parameters, workers):
+        """
+        Shard the test suite across worker processes.
+
+        Each worker is a random_test_runner and a simple_sensor_simulator of its
+        own, isolated from the other workers by ROS_DOMAIN_ID and by the port
+        offset of the simulator. The seed of the test suite is fixed here (if
+        not given), so that every worker derives the same seed for the same
+        test case. The visualizer is not launched in this mode.
+        """
+        seed = int(self.random_test_runner_launch_configuration["seed"].perform(context))
+        if seed < 0:
+            seed = random.SystemRandom().randrange(2 ** 32)
+        print("Test suite seed", seed)
+
+        output_dir = Path(self.random_test_runner_launch_configuration["output_dir"].perform(context))
+        domain_id = int(os.environ.get("ROS_DOMAIN_ID", 0))
+
+        runners = []
+        launch_description = []
+
+        for index in range(workers):
+            worker_output_dir = output_dir / f"worker_{index}"
+            worker_output_dir.mkdir(parents=True, exist_ok=True)
+
+            environment = {"ROS_DOMAIN_ID": str(domain_id + 1 + index)}
+            port_offset = 100 * (1 + index)  # Larger than the number of simulator ports.
+
+            runner = Node(
+                package="random_test_runner",
+                executable="random_test_runner",
+                namespace="simulation",
+                name="random_test_runner",
+                output="screen",
+                arguments=[("__log_level:=info")],
+                additional_env=environment,
+                # NOTE: Must be last, to override the output_dir of the test parameters file.
+                parameters=parameters + [{
+                    "output_dir": str(worker_output_dir),
+                    "port_offset": port_offset,
+                    "seed": seed,
+                    "shard_count": workers,
+                    "shard_index": index,
+                }],
+            )
+            runners.append(runner)
+            launch_description.append(runner)
+
+            simulation_type = self.random_test_runner_launch_configuration["simulator_type"].perform(context)
+            if simulation_type == "simple_sensor_simulator":
+                launch_description.append(
+                    Node(
+                        package="simple_sensor_simulator",
+                        executable="simple_sensor_simulator_node",
+                        name="simple_sensor_simulator_node",
+                        namespace="simulation",
+                        output="log",
+                        arguments=[("__log_level:=warn")],
+                        additional_env=environment,
+                        parameters=[{"port": 8080, "port_offset": port_offset}],
+                    ),
+                )
+
+        remaining = set(runners)
+
+        def on_exit(event, _):
+            remaining.discard(event.action)
+            if not remaining:
+                merge_results(output_dir, workers)
+                return [EmitEvent(event=Shutdown())]
+
+        for runner in runners:
+            launch_description.append(
+                RegisterEventHandler(event_handler=OnProcessExit(target_action=runner, on_exit=on_exit)))
+
+        return launch_description
+
+
+def merge_results(output_dir, workers):
+    """
+    Merge result.junit.xml and result.yaml written by each worker into output_dir.
+
+    Test cases are written back in the order of the whole test suite (the n-th
+    test case was run by worker n % workers), so that the merged result.yaml
+    can be replayed with any number of workers.
+    """
+    testsuites = ET.Element("testsuites")
+    suites = {}
+    for index in range(workers):
+        result = output_dir / f"worker_{index}" / "result.junit.xml"
+        if not result.exists():
+            print("No result was written by worker", index)
+            continue
+        root = ET.parse(result).getroot()
+        for suite in root:
+            name = suite.attrib["name"]
+            if name not in suites:
+                suites[name] = ET.SubElement(testsuites, "testsuite", name=name)
+            suites[name].extend(list(suite))
+    for suite in suites.values():
+        suite[:] = sorted(suite, key=lambda case: int(case.attrib.get("name", 0)))
+    for element in [testsuites] + list(suites.values()):
+        element.set("failures", str(len(element.findall(".//testcase/failure"))))
+        element.set("errors", str(len(element.findall(".//testcase/error"))))
+        element.set("tests", str(len(element.findall(".//testcase"))))
+    ET.ElementTree(testsuites).write(output_dir / "result.junit.xml", encoding="utf-8", xml_declaration=True)
+
+    shards = []
+    for index in range(workers):
+        result = output_dir / f"worker_{index}" / "result.yaml"
+        shards.append(safe_load(result.read_text()) if result.exists() else {})
+    merged = {}
+    for name in set().union(*shards):
+        merged[name] = dict(next(shard[name] for shard in shards if name in shard))
+        test_cases = [shard.get(name, {}).get("test_cases", []) for shard in shards]
+        merged[name]["test_cases"] = [
+            cases[position]
+            for position in range(max(len(cases) for cases in test_cases))
+            for cases in test_cases
+            if position < len(cases)
+        ]
+    with (output_dir / "result.yaml").open("w") as file:
+        safe_dump(merged, file)
+
+    print("Merged results of", workers, "workers into", output_dir)
+
 
 def generate_launch_description():
     launch = RandomTestRunnerLaunch()
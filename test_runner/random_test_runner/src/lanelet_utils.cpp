@@ -21,10 +21,14 @@
 #include <lanelet2_routing/RoutingCost.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <algorithm>
 #include <geographic_msgs/msg/geo_point.hpp>
 #include <geometry/linear_algebra.hpp>
 #include <lanelet2_extension/projection/mgrs_projector.hpp>
+#include <limits>
+#include <numeric>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <utility>
 
 LaneletUtils::LaneletUtils(const boost::filesystem::path & filename)
 {
@@ -43,6 +47,147 @@ LaneletUtils::LaneletUtils(const boost::filesystem::path & filename)
 
   hdmap_utils_ptr_ =
     std::make_shared<hdmap_utils::HdMapUtils>(filename, geographic_msgs::msg::GeoPoint());
+
+  buildSamplingTables(*traffic_rules_vehicle_ptr);
+}
+
+void LaneletUtils::buildSamplingTables(const lanelet::traffic_rules::TrafficRules & traffic_rules)
+{
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    if (traffic_rules.canPass(lanelet)) {
+      sampling_lanelet_ids_.push_back(lanelet.id());
+    }
+  }
+  std::sort(sampling_lanelet_ids_.begin(), sampling_lanelet_ids_.end());
+
+  const std::size_t size = sampling_lanelet_ids_.size();
+  if (size == 0) {
+    return;
+  }
+
+  // Alias table: sampling is a single uniform index and a single biased coin flip
+  std::vector<double> weights(size);
+  double total_length = 0.0;
+  for (std::size_t index = 0; index < size; index++) {
+    weights[index] = getLaneletLength(sampling_lanelet_ids_[index]);
+    total_length += weights[index];
+  }
+  std::vector<std::size_t> small, large;
+  for (std::size_t index = 0; index < size; index++) {
+    weights[index] = total_length > 0.0 ? weights[index] * size / total_length : 1.0;
+    (weights[index] < 1.0 ? small : large).push_back(index);
+  }
+  sampling_probabilities_.assign(size, 1.0);
+  sampling_aliases_.resize(size);
+  std::iota(sampling_aliases_.begin(), sampling_aliases_.end(), 0);
+  while (!small.empty() && !large.empty()) {
+    const std::size_t less = small.back(), more = large.back();
+    small.pop_back();
+    large.pop_back();
+    sampling_probabilities_[less] = weights[less];
+    sampling_aliases_[less] = more;
+    weights[more] = (weights[more] + weights[less]) - 1.0;
+    (weights[more] < 1.0 ? small : large).push_back(more);
+  }
+
+  // Strongly connected components (iterative Tarjan). Components are completed in reverse
+  // topological order, so every component reachable from a component is completed before it.
+  std::unordered_map<int64_t, std::size_t> index_of_lanelet;
+  for (std::size_t index = 0; index < size; index++) {
+    index_of_lanelet.emplace(sampling_lanelet_ids_[index], index);
+  }
+  std::vector<std::vector<std::size_t>> successors(size);
+  for (std::size_t index = 0; index < size; index++) {
+    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(sampling_lanelet_ids_[index]);
+    for (const auto & following : vehicle_routing_graph_ptr_->following(lanelet, false)) {
+      if (const auto iter = index_of_lanelet.find(following.id()); iter != index_of_lanelet.end()) {
+        successors[index].push_back(iter->second);
+      }
+    }
+  }
+
+  constexpr auto unvisited = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> order(size, unvisited), low_link(size), component(size, unvisited);
+  std::vector<std::size_t> stack;
+  std::vector<std::pair<std::size_t, std::size_t>> call_stack;
+  std::size_t visited_count = 0, component_count = 0;
+  for (std::size_t root = 0; root < size; root++) {
+    if (order[root] != unvisited) {
+      continue;
+    }
+    call_stack.emplace_back(root, 0);
+    while (!call_stack.empty()) {
+      auto & [vertex, next_edge] = call_stack.back();
+      if (next_edge == 0) {
+        order[vertex] = low_link[vertex] = visited_count++;
+        stack.push_back(vertex);
+      }
+      if (next_edge < successors[vertex].size()) {
+        const std::size_t successor = successors[vertex][next_edge++];
+        if (order[successor] == unvisited) {
+          call_stack.emplace_back(successor, 0);
+        } else if (component[successor] == unvisited) {
+          low_link[vertex] = std::min(low_link[vertex], order[successor]);
+        }
+        continue;
+      }
+      if (low_link[vertex] == order[vertex]) {
+        std::size_t member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          component[member] = component_count;
+        } while (member != vertex);
+        component_count++;
+      }
+      const std::size_t finished = vertex;
+      call_stack.pop_back();
+      if (!call_stack.empty()) {
+        auto & caller = call_stack.back().first;
+        low_link[caller] = std::min(low_link[caller], low_link[finished]);
+      }
+    }
+  }
+
+  const std::size_t words = (component_count + 63) / 64;
+  reachable_components_.assign(component_count, std::vector<uint64_t>(words, 0));
+  std::vector<std::vector<std::size_t>> members(component_count);
+  for (std::size_t index = 0; index < size; index++) {
+    members[component[index]].push_back(index);
+    component_of_lanelet_.emplace(sampling_lanelet_ids_[index], component[index]);
+  }
+  for (std::size_t current = 0; current < component_count; current++) {
+    auto & reachable = reachable_components_[current];
+    reachable[current / 64] |= uint64_t(1) << (current % 64);
+    for (const auto member : members[current]) {
+      for (const auto successor : successors[member]) {
+        if (const auto next = component[successor]; next != current) {
+          for (std::size_t word = 0; word < words; word++) {
+            reachable[word] |= reachable_components_[next][word];
+          }
+        }
+      }
+    }
+  }
+}
+
+std::size_t LaneletUtils::getSamplingTableSize() const { return sampling_lanelet_ids_.size(); }
+
+int64_t LaneletUtils::sampleLaneletIdWeightedByLength(std::size_t index, double uniform) const
+{
+  const std::size_t sampled =
+    uniform < sampling_probabilities_[index] ? index : sampling_aliases_[index];
+  return sampling_lanelet_ids_[sampled];
+}
+
+bool LaneletUtils::isReachable(int64_t from_lanelet_id, int64_t to_lanelet_id) const
+{
+  const auto from = component_of_lanelet_.find(from_lanelet_id);
+  const auto to = component_of_lanelet_.find(to_lanelet_id);
+  if (from == component_of_lanelet_.end() || to == component_of_lanelet_.end()) {
+    return false;
+  }
+  return (reachable_components_[from->second][to->second / 64] >> (to->second % 64)) & 1;
 }
 
 std::vector<int64_t> LaneletUtils::getLaneletIds() { return hdmap_utils_ptr_->getLaneletIds(); }
@@ -44,11 +44,17 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
       test_suite_params = collectTestSuiteParameters();
       TestCaseParameters test_case_parameters = collectTestCaseParameters();
 
+      // The seed parameter is the seed of the whole test suite and the seed of each test case is
+      // derived from it, so that a suite (or any shard of it) can be reproduced from one number.
+      if (test_case_parameters.seed < 0) {
+        test_case_parameters.seed = seed_randomization_device_();
+      }
+      message = fmt::format("Test suite seed: {}", test_case_parameters.seed);
+      RCLCPP_INFO_STREAM(get_logger(), message);
+
       for (int test_id = 0; test_id < test_control_parameters.test_count; test_id++) {
         TestCaseParameters current_test_case_parameters = test_case_parameters;
-        if (current_test_case_parameters.seed < 0) {
-          current_test_case_parameters.seed = seed_randomization_device_();
-        }
+        current_test_case_parameters.seed += test_id;
         test_case_parameters_vector.emplace_back(current_test_case_parameters);
       }
     } break;
@@ -66,6 +72,7 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
 
   traffic_simulator::Configuration configuration(map_path);
   configuration.simulator_host = test_control_parameters.simulator_host;
+  configuration.port_offset = test_control_parameters.port_offset;
   api_ = std::make_shared<traffic_simulator::API>(this, configuration);
   auto lanelet_utils = std::make_shared<LaneletUtils>(configuration.lanelet2_map_path());
 
@@ -86,6 +93,13 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
   yaml_test_params_saver.addTestSuite(validated_params, validated_params.name);
 
   for (size_t test_id = 0; test_id < test_case_parameters_vector.size(); test_id++) {
+    // In parallel mode, each worker process runs every shard_count-th test case only. Test cases
+    // keep the id they have in the whole suite, so the results of the workers can be merged.
+    if (
+      static_cast<int64_t>(test_id) % test_control_parameters.shard_count !=
+      test_control_parameters.shard_index) {
+      continue;
+    }
     std::string message =
       fmt::format("Generating test {}/{}", test_id + 1, test_case_parameters_vector.size());
     RCLCPP_INFO_STREAM(get_logger(), message);
@@ -144,12 +158,21 @@ TestControlParameters RandomTestRunner::collectAndValidateTestControlParameters(
   tp.architecture_type =
     architectureTypeFromString(this->declare_parameter<std::string>("architecture_type", ""));
   tp.simulator_host = this->declare_parameter<std::string>("simulator_host", "localhost");
+  tp.port_offset = this->declare_parameter<int64_t>("port_offset", 0);
+  tp.shard_count = this->declare_parameter<int64_t>("shard_count", 1);
+  tp.shard_index = this->declare_parameter<int64_t>("shard_index", 0);
 
   if (!tp.input_dir.empty() && !boost::filesystem::is_directory(tp.input_dir)) {
     throw std::runtime_error(
       fmt::format("Input directory {} does not exists or is not a directory", tp.input_dir));
   }
 
+  if (tp.shard_count < 1 || tp.shard_index < 0 || tp.shard_count <= tp.shard_index) {
+    throw std::runtime_error(fmt::format(
+      "Invalid shard {} of {}: shard_count must be positive and shard_index in [0, shard_count)",
+      tp.shard_index, tp.shard_count));
+  }
+
   if (tp.output_dir.empty() || !boost::filesystem::is_directory(tp.output_dir)) {
     throw std::runtime_error(fmt::format(
       "Output directory {} is empty, does not exists or is not a directory", tp.output_dir));
@@ -211,6 +234,13 @@ void RandomTestRunner::update()
 
 void RandomTestRunner::start()
 {
+  if (test_executors_.empty()) {
+    RCLCPP_INFO_STREAM(get_logger(), "No test to run");
+    error_reporter_.write();
+    rclcpp::shutdown();
+    return;
+  }
+
   std::string message = fmt::format(
     "Running test {}/{}", std::distance(test_executors_.begin(), current_test_executor_) + 1,
     test_executors_.size());
@@ -29,17 +29,17 @@ TestRandomizer::TestRandomizer(
   const TestCaseParameters & test_case_parameters, std::shared_ptr<LaneletUtils> lanelet_utils)
 : logger_(logger),
   lanelet_utils_(std::move(lanelet_utils)),
-  lanelet_ids_(lanelet_utils_->getLaneletIds()),
   randomization_engine_(std::make_shared<RandomizationEngine>(test_case_parameters.seed)),
-  lanelet_id_randomizer_(randomization_engine_, 0, static_cast<int>(lanelet_ids_.size()) - 1),
+  lanelet_id_randomizer_(
+    randomization_engine_, 0, static_cast<int64_t>(lanelet_utils_->getSamplingTableSize()) - 1),
   s_value_randomizer_(randomization_engine_, 0.0, 1.0),
   speed_randomizer_(
     randomization_engine_, test_suite_parameters.npc_min_speed,
     test_suite_parameters.npc_max_speed),
   test_suite_parameters_(test_suite_parameters)
 {
-  if (lanelet_ids_.empty()) {
-    throw std::runtime_error("Lanelet ids vector is empty");
+  if (lanelet_utils_->getSamplingTableSize() == 0) {
+    throw std::runtime_error("There is no lanelet passable by vehicles");
   }
 }
 
@@ -130,15 +130,19 @@ bool TestRandomizer::isFeasibleRoute(
     return true;
   }
 
+  if (lanelet_utils_->isReachable(start.lanelet_id, goal.lanelet_id)) {
+    return true;
+  }
+
   auto opposite_lanelet = lanelet_utils_->getOppositeLaneLet(goal);
-  return !lanelet_utils_->getRoute(start.lanelet_id, goal.lanelet_id).empty() ||
-         (opposite_lanelet &&
-          !lanelet_utils_->getRoute(start.lanelet_id, opposite_lanelet->lanelet_id).empty());
+  return opposite_lanelet &&
+         lanelet_utils_->isReachable(start.lanelet_id, opposite_lanelet->lanelet_id);
 }
 
 int64_t TestRandomizer::getRandomLaneletId()
 {
-  return lanelet_ids_[lanelet_id_randomizer_.generate()];
+  const auto index = lanelet_id_randomizer_.generate();
+  return lanelet_utils_->sampleLaneletIdWeightedByLength(index, s_value_randomizer_.generate());
 }
 
 double TestRandomizer::getRandomS(int64_t lanelet_id)
@@ -61,6 +61,10 @@ def launch_setup(context, *args, **kwargs):
     architecture_type       = LaunchConfiguration("architecture_type",       default="awf/universe")
     autoware_launch_file    = LaunchConfiguration("autoware_launch_file",    default=default_autoware_launch_file_of(architecture_type.perform(context)))
     autoware_launch_package = LaunchConfiguration("autoware_launch_package", default=default_autoware_launch_package_of(architecture_type.perform(context)))
+    batch_mode              = LaunchConfiguration("batch_mode",              default=False)
+    broadcast_npc_tf        = LaunchConfiguration("broadcast_npc_tf",        default=True)
+    entity_status_rate      = LaunchConfiguration("entity_status_rate",      default=0.0)
+    free_running            = LaunchConfiguration("free_running",            default=False)
     global_frame_rate       = LaunchConfiguration("global_frame_rate",       default=30.0)
     global_real_time_factor = LaunchConfiguration("global_real_time_factor", default=1.0)
     global_timeout          = LaunchConfiguration("global_timeout",          default=180)
@@ -69,18 +73,29 @@ def launch_setup(context, *args, **kwargs):
     launch_rviz             = LaunchConfiguration("launch_rviz",             default=False)
     output_directory        = LaunchConfiguration("output_directory",        default=Path("/tmp"))
     port                    = LaunchConfiguration("port",                    default=8080)
+    port_offset             = LaunchConfiguration("port_offset",             default=0)
+    profile                 = LaunchConfiguration("profile",                 default=False)
+    profile_trace_path      = LaunchConfiguration("profile_trace_path",      default="")
     record                  = LaunchConfiguration("record",                  default=True)
+    record_topics           = LaunchConfiguration("record_topics",           default=".*")
+    route_cache_capacity    = LaunchConfiguration("route_cache_capacity",    default=4096)
     rviz_config             = LaunchConfiguration("rviz_config",             default="")
     scenario                = LaunchConfiguration("scenario",                default=Path("/dev/null"))
     sensor_model            = LaunchConfiguration("sensor_model",            default="")
     sigterm_timeout         = LaunchConfiguration("sigterm_timeout",         default=8)
     vehicle_model           = LaunchConfiguration("vehicle_model",           default="")
+    waypoint_tolerance      = LaunchConfiguration("waypoint_tolerance",      default=0.1)
+    workers                 = LaunchConfiguration("workers",                 default=1)
     workflow                = LaunchConfiguration("workflow",                default=Path("/dev/null"))
     # fmt: on
 
     print(f"architecture_type       := {architecture_type.perform(context)}")
     print(f"autoware_launch_file    := {autoware_launch_file.perform(context)}")
     print(f"autoware_launch_package := {autoware_launch_package.perform(context)}")
+    print(f"batch_mode              := {batch_mode.perform(context)}")
+    print(f"broadcast_npc_tf        := {broadcast_npc_tf.perform(context)}")
+    print(f"entity_status_rate      := {entity_status_rate.perform(context)}")
+    print(f"free_running            := {free_running.perform(context)}")
     print(f"global_frame_rate       := {global_frame_rate.perform(context)}")
     print(f"global_real_time_factor := {global_real_time_factor.perform(context)}")
     print(f"global_timeout          := {global_timeout.perform(context)}")
@@ -89,12 +104,19 @@ def launch_setup(context, *args, **kwargs):
     print(f"launch_rviz             := {launch_rviz.perform(context)}")
     print(f"output_directory        := {output_directory.perform(context)}")
     print(f"port                    := {port.perform(context)}")
+    print(f"port_offset             := {port_offset.perform(context)}")
+    print(f"profile                 := {profile.perform(context)}")
+    print(f"profile_trace_path      := {profile_trace_path.perform(context)}")
     print(f"record                  := {record.perform(context)}")
+    print(f"record_topics           := {record_topics.perform(context)}")
+    print(f"route_cache_capacity    := {route_cache_capacity.perform(context)}")
     print(f"rviz_config             := {rviz_config.perform(context)}")
     print(f"scenario                := {scenario.perform(context)}")
     print(f"sensor_model            := {sensor_model.perform(context)}")
     print(f"sigterm_timeout         := {sigterm_timeout.perform(context)}")
     print(f"vehicle_model           := {vehicle_model.perform(context)}")
+    print(f"waypoint_tolerance      := {waypoint_tolerance.perform(context)}")
+    print(f"workers                 := {workers.perform(context)}")
     print(f"workflow                := {workflow.perform(context)}")
 
     def make_parameters():
@@ -102,13 +124,23 @@ def launch_setup(context, *args, **kwargs):
             {"architecture_type": architecture_type},
             {"autoware_launch_file": autoware_launch_file},
             {"autoware_launch_package": autoware_launch_package},
+            {"batch_mode": batch_mode},
+            {"broadcast_npc_tf": broadcast_npc_tf},
+            {"entity_status_rate": entity_status_rate},
+            {"free_running": free_running},
             {"initialize_duration": initialize_duration},
             {"launch_autoware": launch_autoware},
             {"port": port},
+            {"port_offset": port_offset},
+            {"profile": profile},
+            {"profile_trace_path": profile_trace_path},
             {"record": record},
+            {"record_topics": record_topics},
+            {"route_cache_capacity": route_cache_capacity},
             {"rviz_config": rviz_config},
             {"sensor_model": sensor_model},
             {"vehicle_model": vehicle_model},
+            {"waypoint_tolerance": waypoint_tolerance},
         ]
 
         def description():
@@ -122,22 +154,69 @@ def launch_setup(context, *args, **kwargs):
 
         return parameters
 
+    def make_launch_arguments():
+        # NOTE: The launch arguments given to each worker of a parallel sweep.
+        # The ones specific to each worker (output_directory, port, scenario,
+        # workflow, ...) are overwritten by scenario_test_runner.
+        launch_arguments = {
+            "architecture_type": architecture_type,
+            "autoware_launch_file": autoware_launch_file,
+            "autoware_launch_package": autoware_launch_package,
+            "batch_mode": batch_mode,
+            "broadcast_npc_tf": broadcast_npc_tf,
+            "entity_status_rate": entity_status_rate,
+            "free_running": free_running,
+            "global_frame_rate": global_frame_rate,
+            "global_real_time_factor": global_real_time_factor,
+            "global_timeout": global_timeout,
+            "initialize_duration": initialize_duration,
+            "launch_autoware": launch_autoware,
+            "port": port,
+            "record": record,
+            "record_topics": record_topics,
+            "sensor_model": sensor_model,
+            "sigterm_timeout": sigterm_timeout,
+            "vehicle_model": vehicle_model,
+            "waypoint_tolerance": waypoint_tolerance,
+        }
+        return [f"{name}:={value.perform(context)}" for name, value in launch_arguments.items()]
+
+    def make_sensor_simulator_profile_trace_path():
+        # NOTE: simple_sensor_simulator is another process, so it cannot write
+        # its zones into the trace file of openscenario_interpreter.
+        path = Path(profile_trace_path.perform(context))
+        if profile_trace_path.perform(context):
+            return str(path.with_suffix(".simple_sensor_simulator" + path.suffix))
+        else:
+            return ""
+
     return [
         # fmt: off
         DeclareLaunchArgument("architecture_type",       default_value=architecture_type      ),
         DeclareLaunchArgument("autoware_launch_file",    default_value=autoware_launch_file   ),
         DeclareLaunchArgument("autoware_launch_package", default_value=autoware_launch_package),
+        DeclareLaunchArgument("batch_mode",              default_value=batch_mode             ),
+        DeclareLaunchArgument("broadcast_npc_tf",        default_value=broadcast_npc_tf       ),
+        DeclareLaunchArgument("entity_status_rate",      default_value=entity_status_rate     ),
+        DeclareLaunchArgument("free_running",            default_value=free_running           ),
         DeclareLaunchArgument("global_frame_rate",       default_value=global_frame_rate      ),
         DeclareLaunchArgument("global_real_time_factor", default_value=global_real_time_factor),
         DeclareLaunchArgument("global_timeout",          default_value=global_timeout         ),
         DeclareLaunchArgument("launch_autoware",         default_value=launch_autoware        ),
         DeclareLaunchArgument("launch_rviz",             default_value=launch_rviz            ),
         DeclareLaunchArgument("output_directory",        default_value=output_directory       ),
+        DeclareLaunchArgument("port_offset",             default_value=port_offset            ),
+        DeclareLaunchArgument("profile",                 default_value=profile                ),
+        DeclareLaunchArgument("profile_trace_path",      default_value=profile_trace_path     ),
+        DeclareLaunchArgument("record_topics",           default_value=record_topics          ),
+        DeclareLaunchArgument("route_cache_capacity",    default_value=route_cache_capacity   ),
         DeclareLaunchArgument("rviz_config",             default_value=rviz_config            ),
         DeclareLaunchArgument("scenario",                default_value=scenario               ),
         DeclareLaunchArgument("sensor_model",            default_value=sensor_model           ),
         DeclareLaunchArgument("sigterm_timeout",         default_value=sigterm_timeout        ),
         DeclareLaunchArgument("vehicle_model",           default_value=vehicle_model          ),
+        DeclareLaunchArgument("waypoint_tolerance",      default_value=waypoint_tolerance     ),
+        DeclareLaunchArgument("workers",                 default_value=workers                ),
         DeclareLaunchArgument("workflow",                default_value=workflow               ),
         # fmt: on
         Node(
@@ -154,7 +233,9 @@ def launch_setup(context, *args, **kwargs):
                 "--global-timeout",          global_timeout,
                 "--output-directory",        output_directory,
                 "--scenario",                scenario,
+                "--workers",                 workers,
                 "--workflow",                workflow,
+                "--launch-arguments",        *make_launch_arguments(),
                 # fmt: on
             ],
         ),
@@ -165,7 +246,14 @@ def launch_setup(context, *args, **kwargs):
             name="simple_sensor_simulator",
             output="screen",
             on_exit=ShutdownOnce(),
-            parameters=[{"port": port}],
+            parameters=[
+                {
+                    "port": port,
+                    "port_offset": port_offset,
+                    "profile": profile,
+                    "profile_trace_path": make_sensor_simulator_profile_trace_path(),
+                }
+            ],
         ),
         LifecycleNode(
             package="openscenario_interpreter",
@@ -183,6 +271,7 @@ def launch_setup(context, *args, **kwargs):
             name="openscenario_preprocessor",
             output="screen",
             on_exit=ShutdownOnce(),
+            parameters=[{"output_directory": str(Path(output_directory.perform(context)) / "openscenario_preprocessor")}],
         ),
         Node(
             package="openscenario_visualization",
@@ -190,6 +279,7 @@ def launch_setup(context, *args, **kwargs):
             namespace="simulation",
             name="openscenario_visualizer",
             output="screen",
+            parameters=[{"broadcast_npc_tf": broadcast_npc_tf}],
         ),
         Node(
             package="rviz2",
@@ -33,6 +33,7 @@ from openscenario_preprocessor_msgs.srv import (
 )
 from openscenario_utility.conversion import convert
 from scenario_test_runner.lifecycle_controller import LifecycleController
+from scenario_test_runner.sweep import Sweep
 from scenario_test_runner.workflow import (
     Expect,
     Scenario,
@@ -75,7 +76,9 @@ class ScenarioTestRunner(LifecycleController):
         global_frame_rate: float,
         global_real_time_factor: float,
         global_timeout: int,  # [sec]
-        output_directory: Path
+        output_directory: Path,
+        workers: int = 1,
+        launch_arguments: List[str] = ()
     ):
         """
         Initialize the class ScenarioTestRunner.
@@ -91,6 +94,15 @@ class ScenarioTestRunner(LifecycleController):
             Output destination directory of the generated file including the
             result file.
 
+        workers : int
+            The maximum number of scenarios derived from a
+            ParameterValueDistribution that are run at the same time. Each of
+            them is run by its own headless launch if greater than 1.
+
+        launch_arguments : List[str]
+            Launch arguments in the form of name:=value, given to the launches
+            of the workers.
+
         Returns
         -------
         None
@@ -116,6 +128,12 @@ class ScenarioTestRunner(LifecycleController):
 
         self.current_workflow = None
 
+        self.sweep = Sweep(
+            workers,
+            dict(each.split(":=", 1) for each in launch_arguments),
+            self.get_logger().info,
+        )
+
         self.check_preprocessor_client = self.create_client(CheckDerivativeRemained,
                                                             '/simulation/openscenario_preprocessor/check')
         while not self.check_preprocessor_client.wait_for_service(timeout_sec=1.0):
@@ -205,7 +223,14 @@ class ScenarioTestRunner(LifecycleController):
                 for preprocessed_scenario in preprocessed_scenarios:
                     self.print_debug(str(preprocessed_scenario.path))
 
-                self.run_preprocessed_scenarios(preprocessed_scenarios)
+                if self.sweep.workers > 1 and len(preprocessed_scenarios) > 1:
+                    result = self.sweep.run(
+                        preprocessed_scenarios,
+                        self.output_directory / xosc_scenario.path.stem,
+                    )
+                    self.print_debug('results are merged into ' + str(result))
+                else:
+                    self.run_preprocessed_scenarios(preprocessed_scenarios)
                 self.print_debug('finish execution')
             else:
                 exit(1)
@@ -317,6 +342,10 @@ def main(args=None):
 
     parser.add_argument("-s", "--scenario", default="/dev/null", type=Path)
 
+    parser.add_argument("-j", "--workers", default=1, type=int)
+
+    parser.add_argument("--launch-arguments", nargs="*", default=[])
+
     parser.add_argument(
         "-w",
         "--workflow",
@@ -334,6 +363,8 @@ def main(args=None):
         global_real_time_factor=args.global_real_time_factor,
         global_timeout=args.global_timeout,
         output_directory=args.output_directory / "scenario_test_runner",
+        workers=args.workers,
+        launch_arguments=args.launch_arguments,
     )
 
     if args.scenario != Path("/dev/null"):
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Copyright 2020 TIER IV, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+import subprocess
+import xml.etree.ElementTree as ET
+
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+from queue import Queue
+from typing import Callable, Dict, List
+from yaml import safe_dump
+
+from scenario_test_runner.workflow import Scenario
+
+
+# NOTE: Larger than the number of ports used by simulation_interface.
+PORT_OFFSET_STRIDE = 100
+
+
+class Sweep:
+    """
+    Run scenarios derived from a ParameterValueDistribution in parallel.
+
+    Each scenario is run by an independent (headless) scenario_test_runner
+    launch. Concurrently running launches are isolated from each other by
+    giving each worker slot its own ROS_DOMAIN_ID and simulator port offset,
+    so that they share neither topics nor the simple_sensor_simulator sockets.
+
+    Attributes
+    ----------
+    workers : int
+        The maximum number of launches running at the same time.
+
+    launch_arguments : Dict[str, str]
+        Launch arguments given to each launch in addition to the ones
+        specific to the worker.
+
+    """
+
+    def __init__(
+        self,
+        workers: int,
+        launch_arguments: Dict[str, str],
+        log: Callable[[str], None] = print,
+    ):
+        self.workers = workers
+
+        self.launch_arguments = launch_arguments
+
+        self.log = log
+
+        self.domain_id = int(os.environ.get("ROS_DOMAIN_ID", 0))
+
+        self.port = int(launch_arguments.get("port", 8080))
+
+    def run(self, scenarios: List[Scenario], output_directory: Path):
+        """
+        Run all given scenarios and merge their results.
+
+        Arguments
+        ---------
+        scenarios : List[Scenario]
+
+        output_directory : Path
+            Each scenario is run with output_directory/<index> as its output
+            directory, and the merged result is written to
+            output_directory/result.junit.xml.
+
+        Returns
+        -------
+        Path
+            The path to the merged result.
+
+        """
+        slots = Queue()
+
+        for slot in range(self.workers):
+            slots.put(slot)
+
+        def run(index, scenario):
+            slot = slots.get()
+            try:
+                return self.run_worker(
+                    slot, scenario, output_directory / str(index), index, len(scenarios)
+                )
+            finally:
+                slots.put(slot)
+
+        with ThreadPoolExecutor(max_workers=self.workers) as executor:
+            results = list(executor.map(run, range(len(scenarios)), scenarios))
+
+        return merge_junit(results, output_directory / "result.junit.xml")
+
+    def run_worker(
+        self, slot: int, scenario: Scenario, output_directory: Path, index: int, length: int
+    ):
+        output_directory.mkdir(parents=True, exist_ok=True)
+
+        # NOTE: A workflow file is used instead of the `scenario` launch
+        # argument to preserve the expectation and the frame rate of the
+        # scenario.
+        workflow = output_directory / "workflow.yaml"
+
+        with workflow.open("w") as file:
+            safe_dump(
+                {
+                    "Scenario": [
+                        {
+                            "path": str(scenario.path),
+                            "expect": scenario.expect.name,
+                            "frame-rate": scenario.frame_rate,
+                        }
+                    ]
+                },
+                file,
+            )
+
+        arguments = dict(self.launch_arguments)
+        arguments.update(
+            {
+                "launch_rviz": "False",
+                "output_directory": str(output_directory),
+                "port": str(self.port + 1 + slot),
+                "port_offset": str(PORT_OFFSET_STRIDE * (1 + slot)),
+                "scenario": "/dev/null",
+                "workers": "1",
+                "workflow": str(workflow),
+            }
+        )
+
+        self.log(
+            f"Run {scenario.path.name} ({index + 1} of {length}) on worker {slot}"
+        )
+
+        with (output_directory / "launch.log").open("w") as log:
+            subprocess.run(
+                ["ros2", "launch", "scenario_test_runner", "scenario_test_runner.launch.py"]
+                + [f"{key}:={value}" for key, value in arguments.items()],
+                env=dict(os.environ, ROS_DOMAIN_ID=str(self.domain_id + 1 + slot)),
+                stdout=log,
+                stderr=subprocess.STDOUT,
+            )
+
+        return output_directory / "scenario_test_runner" / "result.junit.xml"
+
+
+def merge_junit(results: List[Path], output: Path):
+    """
+    Merge junit results written by each worker into a single file.
+
+    Testcases are grouped by the name of their testsuite. A worker that did
+    not write its result (e.g. crashed before the interpreter was configured)
+    is reported as an error of its own testcase, so that it is not silently
+    dropped from the sweep.
+
+    Arguments
+    ---------
+    results : List[Path]
+
+    output : Path
+
+    Returns
+    -------
+    Path
+        The given output path.
+
+    """
+    testsuites = ET.Element("testsuites")
+    suites = {}
+
+    def testsuite(name):
+        if name not in suites:
+            suites[name] = ET.SubElement(testsuites, "testsuite", name=name)
+        return suites[name]
+
+    for result in results:
+        if result.exists():
+            root = ET.parse(result).getroot()
+            testsuites.set("name", root.attrib.get("name", ""))
+            for suite in root:
+                for case in suite:
+                    testsuite(suite.attrib["name"]).append(case)
+        else:
+            case = ET.SubElement(
+                testsuite("sweep"), "testcase", name=str(result.parent.parent)
+            )
+            ET.SubElement(
+                case, "error", type="WorkerError", message="no result was written"
+            )
+
+    for element in [testsuites] + list(suites.values()):
+        element.set("failures", str(len(element.findall(".//testcase/failure"))))
+        element.set("errors", str(len(element.findall(".//testcase/error"))))
+        element.set("tests", str(len(element.findall(".//testcase"))))
+
+    output.parent.mkdir(parents=True, exist_ok=True)
+
+    ET.ElementTree(testsuites).write(output, encoding="utf-8", xml_declaration=True)
+
+    return output